@@ -0,0 +1,133 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "codec_kernels.h"
+
+#define CODEC_UNRESOLVED CODEC_KERNEL_COUNT
+
+typedef struct {
+    const char* name;
+    void (*base32)( const uint8_t* data, size_t groups, char* out );
+    void (*hex)( const uint8_t* data, size_t length, char* out, bool reverse );
+} codec_entry_t;
+
+static void codec_hex_scalar( const uint8_t* data, size_t length, char* out, bool reverse )
+{
+    codec_hex_tail( data, length, 0, out, reverse );
+}
+
+// every entry can be called: the kernel may change between a caller's check and its call
+static const codec_entry_t KERNELS[CODEC_KERNEL_COUNT] = {
+    [CODEC_SCALAR] = { "scalar", codec_base32_tail, codec_hex_scalar },
+#ifdef CODEC_HAVE_X86
+    [CODEC_SSSE3]  = { "ssse3", codec_base32_ssse3, codec_hex_ssse3 },
+    [CODEC_AVX2]   = { "avx2", codec_base32_avx2, codec_hex_avx2 },
+#else
+    [CODEC_SSSE3]  = { "ssse3", codec_base32_tail, codec_hex_scalar },
+    [CODEC_AVX2]   = { "avx2", codec_base32_tail, codec_hex_scalar },
+#endif
+#ifdef CODEC_HAVE_NEON
+    [CODEC_NEON]   = { "neon", codec_base32_neon, codec_hex_neon },
+#else
+    [CODEC_NEON]   = { "neon", codec_base32_tail, codec_hex_scalar },
+#endif
+};
+
+// written once with the same value by whichever thread gets there first
+static int G_codec_kernel = CODEC_UNRESOLVED;
+
+bool codec_supported( codec_kernel_e kernel )
+{
+    switch( kernel ) {
+        case CODEC_SCALAR:
+            return true;
+#ifdef CODEC_HAVE_X86
+        case CODEC_SSSE3:
+            return __builtin_cpu_supports( "ssse3" );
+        case CODEC_AVX2:
+            return __builtin_cpu_supports( "avx2" );
+#endif
+#ifdef CODEC_HAVE_NEON
+        case CODEC_NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+const char* codec_kernel_name( codec_kernel_e kernel )
+{
+    return kernel < CODEC_KERNEL_COUNT ? KERNELS[kernel].name : "unknown";
+}
+
+codec_kernel_e codec_kernel( void )
+{
+    int kernel = __atomic_load_n( &G_codec_kernel, __ATOMIC_RELAXED );
+    if( kernel == CODEC_UNRESOLVED ) {
+        kernel = CODEC_SCALAR;
+        for( int candidate = CODEC_KERNEL_COUNT - 1; candidate > CODEC_SCALAR; candidate-- ) {
+            if( codec_supported( (codec_kernel_e) candidate ) ) {
+                kernel = candidate;
+                break;
+            }
+        }
+        __atomic_store_n( &G_codec_kernel, kernel, __ATOMIC_RELAXED );
+    }
+    return (codec_kernel_e) kernel;
+}
+
+bool codec_select( codec_kernel_e kernel )
+{
+    if( !codec_supported( kernel ) ) {
+        return false;
+    }
+    __atomic_store_n( &G_codec_kernel, (int) kernel, __ATOMIC_RELAXED );
+    return true;
+}
+
+void codec_base32( const uint8_t* data, size_t groups, char* out )
+{
+    KERNELS[codec_kernel()].base32( data, groups, out );
+}
+
+void codec_hex( const uint8_t* data, size_t length, char* out, bool reverse )
+{
+    KERNELS[codec_kernel()].hex( data, length, out, reverse );
+}
+
+static const char BASE32_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+void codec_base32_tail( const uint8_t* data, size_t groups, char* out )
+{
+    for( ; groups > 0; groups--, data += 5, out += 8 ) {
+        uint64_t bits = (uint64_t) data[0] << 32 | (uint64_t) data[1] << 24 | (uint64_t) data[2] << 16 |
+                        (uint64_t) data[3] << 8 | data[4];
+        for( int i = 0; i < 8; i++ ) {
+            out[i] = BASE32_ALPHABET[(bits >> (35 - 5 * i)) & 0x1F];
+        }
+    }
+}
+
+void codec_hex_tail( const uint8_t* data, size_t length, size_t done, char* out, bool reverse )
+{
+    for( size_t i = done; i < length; i++ ) {
+        uint8_t byte = reverse ? data[length - 1 - i] : data[i];
+        out[2 * i] = HEX_DIGITS[byte >> 4];
+        out[2 * i + 1] = HEX_DIGITS[byte & 0x0F];
+    }
+}
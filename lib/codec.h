@@ -0,0 +1,68 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef SYMBOL_DISPLAY_CODEC_H
+#define SYMBOL_DISPLAY_CODEC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Vector kernels for the base32 and hex encoders of the host library.
+ *
+ * 'base32_encode()' and 'snprintf_hex()' keep their device interface and
+ * behaviour; when built with HAVE_CODEC_KERNELS they hand the bulk of their
+ * input to the kernel selected here and finish with their own code. The
+ * kernel is picked on first use from what the CPU supports; CODEC_SCALAR
+ * means the device code alone.
+ */
+
+typedef enum {
+    CODEC_SCALAR,
+    CODEC_SSSE3,
+    CODEC_AVX2,
+    CODEC_NEON,
+    CODEC_KERNEL_COUNT
+} codec_kernel_e;
+
+/**
+ * Kernel in use, selected on first call.
+ */
+codec_kernel_e codec_kernel( void );
+
+/**
+ * Use 'kernel' from now on, false (and nothing changed) if the CPU or the
+ * build does not support it. Meant for tests and benchmarks.
+ */
+bool codec_select( codec_kernel_e kernel );
+
+bool        codec_supported( codec_kernel_e kernel );
+const char* codec_kernel_name( codec_kernel_e kernel );
+
+/**
+ * Encode 'groups' groups of 5 bytes into 8 base32 characters each,
+ * no padding, no terminating zero. CODEC_SCALAR encodes them one by one.
+ */
+void codec_base32( const uint8_t* data, size_t groups, char* out );
+
+/**
+ * Write the 2 * 'length' upper case hex characters of 'data', last byte
+ * first if 'reverse', no terminating zero. CODEC_SCALAR writes them byte by byte.
+ */
+void codec_hex( const uint8_t* data, size_t length, char* out, bool reverse );
+
+#endif // SYMBOL_DISPLAY_CODEC_H
@@ -0,0 +1,48 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef SYMBOL_DISPLAY_CODEC_KERNELS_H
+#define SYMBOL_DISPLAY_CODEC_KERNELS_H
+
+#include "codec.h"
+
+/*
+ * Kernels behind 'codec.h'. Each architecture file defines its kernels only
+ * when compiled for that architecture; the others are left undefined and
+ * reported as unsupported.
+ */
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CODEC_HAVE_X86
+void codec_base32_ssse3( const uint8_t* data, size_t groups, char* out );
+void codec_hex_ssse3( const uint8_t* data, size_t length, char* out, bool reverse );
+void codec_base32_avx2( const uint8_t* data, size_t groups, char* out );
+void codec_hex_avx2( const uint8_t* data, size_t length, char* out, bool reverse );
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define CODEC_HAVE_NEON
+void codec_base32_neon( const uint8_t* data, size_t groups, char* out );
+void codec_hex_neon( const uint8_t* data, size_t length, char* out, bool reverse );
+#endif
+
+/**
+ * Scalar tails shared by the kernels.
+ */
+void codec_base32_tail( const uint8_t* data, size_t groups, char* out );
+void codec_hex_tail( const uint8_t* data, size_t length, size_t done, char* out, bool reverse );
+
+#endif // SYMBOL_DISPLAY_CODEC_KERNELS_H
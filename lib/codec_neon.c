@@ -0,0 +1,90 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "codec_kernels.h"
+
+#ifdef CODEC_HAVE_NEON
+
+#include <string.h>
+#include <arm_neon.h>
+
+/*
+ * Same scheme as 'codec_x86.c', with tbl for the byte shuffles and a
+ * negative vshl for the per lane right shifts. NEON is part of AArch64, no
+ * check is needed before using it.
+ */
+
+static const uint8_t BASE32_LANES[2][16] = {
+    { 1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 0xFF, 4 },
+    { 6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 0xFF, 9 },
+};
+
+static const int16_t BASE32_SHIFTS[8] = { -11, -6, -9, -4, -7, -10, -5, -8 };
+
+static const uint8_t HEX_TABLE[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+};
+
+static uint16x8_t base32_group( uint8x16_t in, const uint8_t* lanes, int16x8_t shifts )
+{
+    uint16x8_t pairs = vreinterpretq_u16_u8( vqtbl1q_u8( in, vld1q_u8( lanes ) ) );
+    return vandq_u16( vshlq_u16( pairs, shifts ), vdupq_n_u16( 0x1F ) );
+}
+
+void codec_base32_neon( const uint8_t* data, size_t groups, char* out )
+{
+    const int16x8_t shifts = vld1q_s16( BASE32_SHIFTS );
+
+    for( ; groups >= 2; groups -= 2, data += 10, out += 16 ) {
+        uint8x16_t in;
+        if( groups * 5 >= 16 ) {
+            in = vld1q_u8( data );
+        } else {
+            uint8_t last[16] = { 0 };
+            memcpy( last, data, 10 );
+            in = vld1q_u8( last );
+        }
+        uint8x16_t index = vcombine_u8( vmovn_u16( base32_group( in, BASE32_LANES[0], shifts ) ),
+                                        vmovn_u16( base32_group( in, BASE32_LANES[1], shifts ) ) );
+        uint8x16_t letters = vaddq_u8( index, vdupq_n_u8( 'A' ) );
+        uint8x16_t digits = vandq_u8( vcgtq_u8( index, vdupq_n_u8( 25 ) ), vdupq_n_u8( 'A' - '2' + 26 ) );
+        vst1q_u8( (uint8_t*) out, vsubq_u8( letters, digits ) );
+    }
+    codec_base32_tail( data, groups, out );
+}
+
+void codec_hex_neon( const uint8_t* data, size_t length, char* out, bool reverse )
+{
+    const uint8x16_t table = vld1q_u8( HEX_TABLE );
+
+    size_t done = 0;
+    for( ; done + 16 <= length; done += 16 ) {
+        uint8x16_t in;
+        if( !reverse ) {
+            in = vld1q_u8( data + done );
+        } else {
+            in = vrev64q_u8( vld1q_u8( data + length - done - 16 ) );
+            in = vextq_u8( in, in, 8 );
+        }
+        uint8x16_t high = vqtbl1q_u8( table, vshrq_n_u8( in, 4 ) );
+        uint8x16_t low = vqtbl1q_u8( table, vandq_u8( in, vdupq_n_u8( 0x0F ) ) );
+        vst1q_u8( (uint8_t*) (out + 2 * done), vzip1q_u8( high, low ) );
+        vst1q_u8( (uint8_t*) (out + 2 * done + 16), vzip2q_u8( high, low ) );
+    }
+    codec_hex_tail( data, length, done, out, reverse );
+}
+
+#endif // CODEC_HAVE_NEON
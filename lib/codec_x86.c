@@ -0,0 +1,169 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "codec_kernels.h"
+
+#ifdef CODEC_HAVE_X86
+
+#include <string.h>
+#include <immintrin.h>
+
+/*
+ * The functions are compiled for their instruction set with the target
+ * attribute, the rest of the library stays baseline x86 and 'codec.c' only
+ * calls them once the CPU has been checked.
+ *
+ * Base32: a group of 5 bytes is a 40 bits big endian number giving 8
+ * characters. Character j is taken from a 16 bits lane holding the two bytes
+ * its 5 bits straddle (pshufb), shifted right by a per lane amount (mulhi by
+ * a power of two) and masked. Index i is then 'A' + i, or '2' + i - 26 from
+ * 26 on.
+ *
+ * Hex: each byte is split in nibbles which pick their digit from a 16 byte
+ * table (pshufb), the two digit vectors are then interleaved.
+ */
+
+#define SSSE3 __attribute__((target("ssse3")))
+#define AVX2  __attribute__((target("avx2")))
+
+#define BASE32_LANES(g) \
+    1 + g, 0 + g, 1 + g, 0 + g, 2 + g, 1 + g, 2 + g, 1 + g, 3 + g, 2 + g, 4 + g, 3 + g, 4 + g, 3 + g, -1, 4 + g
+
+#define BASE32_SHIFTS 1 << 5, 1 << 10, 1 << 7, 1 << 12, 1 << 9, 1 << 6, 1 << 11, 1 << 8
+
+#define HEX_TABLE '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+
+#define REVERSE_LANE 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+
+SSSE3 static __m128i base32_ascii_128( __m128i index )
+{
+    __m128i letters = _mm_add_epi8( index, _mm_set1_epi8( 'A' ) );
+    __m128i digits = _mm_and_si128( _mm_cmpgt_epi8( index, _mm_set1_epi8( 25 ) ), _mm_set1_epi8( 'A' - '2' + 26 ) );
+    return _mm_sub_epi8( letters, digits );
+}
+
+// 2 groups from the first 10 bytes of 'in'
+SSSE3 static __m128i base32_two_groups( __m128i in )
+{
+    const __m128i first = _mm_setr_epi8( BASE32_LANES(0) );
+    const __m128i second = _mm_setr_epi8( BASE32_LANES(5) );
+    const __m128i shifts = _mm_setr_epi16( BASE32_SHIFTS );
+    const __m128i mask = _mm_set1_epi16( 0x1F );
+
+    __m128i a = _mm_and_si128( _mm_mulhi_epu16( _mm_shuffle_epi8( in, first ), shifts ), mask );
+    __m128i b = _mm_and_si128( _mm_mulhi_epu16( _mm_shuffle_epi8( in, second ), shifts ), mask );
+    return base32_ascii_128( _mm_packus_epi16( a, b ) );
+}
+
+SSSE3 void codec_base32_ssse3( const uint8_t* data, size_t groups, char* out )
+{
+    for( ; groups >= 2; groups -= 2, data += 10, out += 16 ) {
+        __m128i in;
+        if( groups * 5 >= 16 ) {
+            in = _mm_loadu_si128( (const __m128i*) data );
+        } else {
+            uint8_t last[16] = { 0 };
+            memcpy( last, data, 10 );
+            in = _mm_loadu_si128( (const __m128i*) last );
+        }
+        _mm_storeu_si128( (__m128i*) out, base32_two_groups( in ) );
+    }
+    codec_base32_tail( data, groups, out );
+}
+
+AVX2 void codec_base32_avx2( const uint8_t* data, size_t groups, char* out )
+{
+    const __m256i lanes0 = _mm256_setr_epi8( BASE32_LANES(0), BASE32_LANES(0) );
+    const __m256i lanes1 = _mm256_setr_epi8( BASE32_LANES(5), BASE32_LANES(5) );
+    const __m256i shifts = _mm256_setr_epi16( BASE32_SHIFTS, BASE32_SHIFTS );
+    const __m256i mask = _mm256_set1_epi16( 0x1F );
+
+    // groups 0 and 1 in the low lane, 2 and 3 in the high lane: reads 26 bytes
+    for( ; groups >= 6; groups -= 4, data += 20, out += 32 ) {
+        __m256i in = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( (const __m128i*) data ) ),
+                                              _mm_loadu_si128( (const __m128i*) (data + 10) ), 1 );
+        __m256i a = _mm256_and_si256( _mm256_mulhi_epu16( _mm256_shuffle_epi8( in, lanes0 ), shifts ), mask );
+        __m256i b = _mm256_and_si256( _mm256_mulhi_epu16( _mm256_shuffle_epi8( in, lanes1 ), shifts ), mask );
+        __m256i index = _mm256_packus_epi16( a, b );
+
+        __m256i letters = _mm256_add_epi8( index, _mm256_set1_epi8( 'A' ) );
+        __m256i digits = _mm256_and_si256( _mm256_cmpgt_epi8( index, _mm256_set1_epi8( 25 ) ),
+                                           _mm256_set1_epi8( 'A' - '2' + 26 ) );
+        _mm256_storeu_si256( (__m256i*) out, _mm256_sub_epi8( letters, digits ) );
+    }
+    codec_base32_ssse3( data, groups, out );
+}
+
+// bytes [offset, offset + 16) of the output order
+SSSE3 static __m128i hex_load_128( const uint8_t* data, size_t length, size_t offset, bool reverse )
+{
+    if( !reverse ) {
+        return _mm_loadu_si128( (const __m128i*) (data + offset) );
+    }
+    __m128i in = _mm_loadu_si128( (const __m128i*) (data + length - offset - 16) );
+    return _mm_shuffle_epi8( in, _mm_setr_epi8( REVERSE_LANE ) );
+}
+
+SSSE3 void codec_hex_ssse3( const uint8_t* data, size_t length, char* out, bool reverse )
+{
+    const __m128i table = _mm_setr_epi8( HEX_TABLE );
+    const __m128i nibble = _mm_set1_epi8( 0x0F );
+
+    size_t done = 0;
+    for( ; done + 16 <= length; done += 16 ) {
+        __m128i in = hex_load_128( data, length, done, reverse );
+        __m128i high = _mm_shuffle_epi8( table, _mm_and_si128( _mm_srli_epi16( in, 4 ), nibble ) );
+        __m128i low = _mm_shuffle_epi8( table, _mm_and_si128( in, nibble ) );
+        _mm_storeu_si128( (__m128i*) (out + 2 * done), _mm_unpacklo_epi8( high, low ) );
+        _mm_storeu_si128( (__m128i*) (out + 2 * done + 16), _mm_unpackhi_epi8( high, low ) );
+    }
+    codec_hex_tail( data, length, done, out, reverse );
+}
+
+AVX2 void codec_hex_avx2( const uint8_t* data, size_t length, char* out, bool reverse )
+{
+    const __m256i table = _mm256_setr_epi8( HEX_TABLE, HEX_TABLE );
+    const __m256i nibble = _mm256_set1_epi8( 0x0F );
+
+    size_t done = 0;
+    for( ; done + 32 <= length; done += 32 ) {
+        __m256i in;
+        if( !reverse ) {
+            in = _mm256_loadu_si256( (const __m256i*) (data + done) );
+        } else {
+            in = _mm256_loadu_si256( (const __m256i*) (data + length - done - 32) );
+            in = _mm256_shuffle_epi8( in, _mm256_setr_epi8( REVERSE_LANE, REVERSE_LANE ) );
+            in = _mm256_permute4x64_epi64( in, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+        }
+        __m256i high = _mm256_shuffle_epi8( table, _mm256_and_si256( _mm256_srli_epi16( in, 4 ), nibble ) );
+        __m256i low = _mm256_shuffle_epi8( table, _mm256_and_si256( in, nibble ) );
+        // unpack works per 128 bits lane: put the digits of bytes 0-15 first
+        __m256i first = _mm256_unpacklo_epi8( high, low );
+        __m256i second = _mm256_unpackhi_epi8( high, low );
+        _mm256_storeu_si256( (__m256i*) (out + 2 * done), _mm256_permute2x128_si256( first, second, 0x20 ) );
+        _mm256_storeu_si256( (__m256i*) (out + 2 * done + 32), _mm256_permute2x128_si256( first, second, 0x31 ) );
+    }
+    if( done < length ) {
+        // reversed, the bytes left to print are the first 'length - done' ones
+        if( reverse ) {
+            codec_hex_ssse3( data, length - done, out + 2 * done, true );
+        } else {
+            codec_hex_ssse3( data + done, length - done, out + 2 * done, false );
+        }
+    }
+}
+
+#endif // CODEC_HAVE_X86
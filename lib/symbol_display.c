@@ -0,0 +1,129 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "symbol_display.h"
+#include <stdio.h>
+#include <string.h>
+#include "xym/parse/xym_parse.h"
+#include "xym/format/format.h"
+#include "xym/format/printers.h"
+
+// largest transaction the device stores, see 'handle_packet_content()'
+#define DEVICE_MAX_TX_LENGTH (MAX_RAW_TX - 4)
+
+_Static_assert( sizeof(fields_array_t) <= SYMBOL_DISPLAY_ARENA_SIZE, "arena too small" );
+_Static_assert( MAX_FIELDNAME_LEN <= SYMBOL_DISPLAY_LABEL_SIZE, "label too small" );
+_Static_assert( MAX_FIELD_LEN <= SYMBOL_DISPLAY_VALUE_SIZE, "value too small" );
+_Static_assert( (int) E_NOT_ENOUGH_DATA == (int) SYMBOL_DISPLAY_NOT_ENOUGH_DATA && (int) E_INVALID_DATA == (int) SYMBOL_DISPLAY_INVALID_DATA &&
+                (int) E_TOO_MANY_FIELDS == (int) SYMBOL_DISPLAY_TOO_MANY_FIELDS && (int) E_DATA_TOO_LARGE == (int) SYMBOL_DISPLAY_DATA_TOO_LARGE,
+                "status codes differ from the parser" );
+
+static fields_array_t* fields_of( symbol_display_arena_t* arena )
+{
+    return (fields_array_t*) arena->bytes;
+}
+
+static const fields_array_t* const_fields_of( const symbol_display_arena_t* arena )
+{
+    return (const fields_array_t*) arena->bytes;
+}
+
+int symbol_display_parse( symbol_display_arena_t* arena, const uint8_t* data, size_t length, symbol_display_network_t network )
+{
+    fields_array_t* fields = fields_of( arena );
+    fields->numFields = 0;
+
+    // the device checks the header before the rest is uploaded, then parses the whole transaction
+    const bool     isMainnet = (network == SYMBOL_DISPLAY_MAINNET);
+    const buffer_t header    = { data, length, 0 };
+    const int      status    = check_txn_header( &header, isMainnet, DEVICE_MAX_TX_LENGTH );
+    if( status != E_SUCCESS )
+    {
+        return status;
+    }
+
+    if( length > DEVICE_MAX_TX_LENGTH )
+    {
+        return SYMBOL_DISPLAY_DATA_TOO_LARGE;
+    }
+
+    buffer_t rawTx = { data, length, 0 };
+    const int result = parse_txn_context( &rawTx, isMainnet, fields );
+    if( result != E_SUCCESS )
+    {
+        fields->numFields = 0;
+    }
+
+    return result;
+}
+
+size_t symbol_display_parse_batch( symbol_display_arena_t* arenas, const symbol_display_tx_t* txs, int* statuses,
+                                   size_t count, symbol_display_network_t network )
+{
+    size_t parsed = 0;
+    for( size_t i = 0; i < count; i++ )
+    {
+        statuses[i] = symbol_display_parse( &arenas[i], txs[i].data, txs[i].length, network );
+        if( statuses[i] == SYMBOL_DISPLAY_OK )
+        {
+            parsed++;
+        }
+    }
+
+    return parsed;
+}
+
+size_t symbol_display_sign_length( const symbol_display_arena_t* arena )
+{
+    return const_fields_of( arena )->signLength;
+}
+
+void symbol_display_begin( const symbol_display_arena_t* arena, symbol_display_iter_t* iter )
+{
+    iter->arena = arena;
+    iter->field = 0;
+    iter->page  = 0;
+}
+
+bool symbol_display_next( symbol_display_iter_t* iter, char label[SYMBOL_DISPLAY_LABEL_SIZE], char value[SYMBOL_DISPLAY_VALUE_SIZE] )
+{
+    const fields_array_t* fields = const_fields_of( iter->arena );
+    if( iter->field >= fields->numFields )
+    {
+        return false;
+    }
+
+    const field_t* field     = &fields->arr[iter->field];
+    const uint8_t  pageCount = field_page_count( field );
+
+    // same title and value as 'update_title()' and 'update_value()' of the review flow
+    resolve_fieldname( field, label );
+    if( pageCount > 1 )
+    {
+        const size_t len = strlen( label );
+        snprintf( label + len, MAX_FIELDNAME_LEN - len, " (%d/%d)", iter->page + 1, pageCount );
+    }
+    format_field_page( field, iter->page, value );
+
+    if( ++iter->page >= pageCount )
+    {
+        iter->field++;
+        iter->page = 0;
+    }
+
+    return true;
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef SYMBOL_DISPLAY_H
+#define SYMBOL_DISPLAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Host library that shows what the Ledger app displays for a transaction.
+ *
+ * It is built from the app's own parser and formatter with the Nano X/S+
+ * limits. Nothing is allocated: a transaction is parsed into an arena owned
+ * by the caller, then its screens are read as (label, value) pairs. The
+ * fields point into the transaction bytes, which must stay valid while the
+ * arena is used. Different arenas can be used from different threads.
+ *
+ * The review flow of the app adds screens around these pairs (review,
+ * approve, reject) and, for aggregates, an index of the inner transactions.
+ */
+
+#if defined(_WIN32)
+#define SYMBOL_DISPLAY_API
+#else
+#define SYMBOL_DISPLAY_API __attribute__((visibility("default")))
+#endif
+
+#define SYMBOL_DISPLAY_ARENA_SIZE 4096  ///< bytes of an arena
+#define SYMBOL_DISPLAY_LABEL_SIZE 64    ///< size of a label, terminating zero included
+#define SYMBOL_DISPLAY_VALUE_SIZE 256   ///< size of a value, terminating zero included
+
+typedef enum {
+    SYMBOL_DISPLAY_OK              =  0,
+    SYMBOL_DISPLAY_NOT_ENOUGH_DATA = -1,  ///< the transaction is truncated
+    SYMBOL_DISPLAY_INVALID_DATA    = -2,  ///< not supported, wrong network or malformed
+    SYMBOL_DISPLAY_TOO_MANY_FIELDS = -3,  ///< more fields than the device can show
+    SYMBOL_DISPLAY_DATA_TOO_LARGE  = -4,  ///< larger than the device can store
+} symbol_display_status_t;
+
+typedef enum {
+    SYMBOL_DISPLAY_TESTNET = 0,
+    SYMBOL_DISPLAY_MAINNET = 1,   ///< signed with coin type 4343
+} symbol_display_network_t;
+
+typedef union {
+    void*         pointerAlignment;
+    uint64_t      integerAlignment;
+    unsigned char bytes[SYMBOL_DISPLAY_ARENA_SIZE];
+} symbol_display_arena_t;
+
+typedef struct {
+    const uint8_t* data;    ///< transaction as sent to SIGN_TX, without the BIP32 path
+    size_t         length;
+} symbol_display_tx_t;
+
+typedef struct {
+    const symbol_display_arena_t* arena;
+    uint8_t                       field;
+    uint8_t                       page;
+} symbol_display_iter_t;
+
+/**
+ * Parses a transaction into 'arena'. The device refuses a transaction for
+ * any status but SYMBOL_DISPLAY_OK.
+ */
+SYMBOL_DISPLAY_API int symbol_display_parse( symbol_display_arena_t*  arena,
+                                             const uint8_t*           data,
+                                             size_t                   length,
+                                             symbol_display_network_t network );
+
+/**
+ * Parses 'count' transactions into as many arenas, 'statuses[i]' is the
+ * result for 'txs[i]'. Returns the number of transactions parsed.
+ */
+SYMBOL_DISPLAY_API size_t symbol_display_parse_batch( symbol_display_arena_t*    arenas,
+                                                      const symbol_display_tx_t* txs,
+                                                      int*                       statuses,
+                                                      size_t                     count,
+                                                      symbol_display_network_t   network );
+
+/**
+ * Number of bytes at the start of the transaction that the device signs.
+ */
+SYMBOL_DISPLAY_API size_t symbol_display_sign_length( const symbol_display_arena_t* arena );
+
+/**
+ * Starts reading the screens of a parsed transaction.
+ */
+SYMBOL_DISPLAY_API void symbol_display_begin( const symbol_display_arena_t* arena, symbol_display_iter_t* iter );
+
+/**
+ * Renders the next screen. Values too long for one screen are split into
+ * pages, their label ends with the page number as on the device.
+ * Returns false once all screens have been read.
+ */
+SYMBOL_DISPLAY_API bool symbol_display_next( symbol_display_iter_t* iter,
+                                             char                   label[SYMBOL_DISPLAY_LABEL_SIZE],
+                                             char                   value[SYMBOL_DISPLAY_VALUE_SIZE] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SYMBOL_DISPLAY_H
@@ -0,0 +1,176 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "address_book.h"
+#include <string.h>
+#include "storage.h"
+
+static const address_book_t* book( void )
+{
+    return (const address_book_t*) &N_storage.addressBook;
+}
+
+// index of 'address', or where it would be inserted
+static uint16_t lower_bound( const address_book_t* addressBook, const uint8_t* address )
+{
+    uint16_t low  = 0;
+    uint16_t high = addressBook->count;
+    while( low < high )
+    {
+        const uint16_t middle = low + (high - low) / 2;
+        if( memcmp(addressBook->entries[middle].address, address, XYM_ADDRESS_LENGTH) < 0 )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+static void write_count( uint16_t count )
+{
+    nvm_write( (void*) &N_storage.addressBook.count, &count, sizeof(count) );
+}
+
+static void write_next( uint16_t next )
+{
+    nvm_write( (void*) &N_storage.addressBook.journal.next, &next, sizeof(next) );
+}
+
+static void write_update( uint8_t update )
+{
+    nvm_write( (void*) &N_storage.addressBook.journal.update, &update, sizeof(update) );
+}
+
+// entries are copied to RAM before being written back, one at a time
+static void move_entry( uint16_t to, uint16_t from )
+{
+    address_entry_t entry;
+    memcpy( &entry, &book()->entries[from], sizeof(entry) );
+    nvm_write( (void*) &N_storage.addressBook.entries[to], &entry, sizeof(entry) );
+}
+
+// An entry is only overwritten once it has been moved, so the move at 'next'
+// can be done again after a power loss.
+static void apply_journal( void )
+{
+    const address_book_journal_t* journal = &book()->journal;
+    address_entry_t entry;
+
+    if( journal->update == ADDRESS_BOOK_ADDING )
+    {
+        for( uint16_t i = journal->next; i > journal->index; i-- )
+        {
+            move_entry( i, i - 1 );
+            write_next( i - 1 );
+        }
+        memcpy( &entry, &journal->entry, sizeof(entry) );
+        nvm_write( (void*) &N_storage.addressBook.entries[journal->index], &entry, sizeof(entry) );
+    }
+    else if( journal->update == ADDRESS_BOOK_REMOVING )
+    {
+        for( uint16_t i = journal->next; i < journal->count; i++ )
+        {
+            move_entry( i, i + 1 );
+            write_next( i + 1 );
+        }
+        memset( &entry, 0, sizeof(entry) );
+        nvm_write( (void*) &N_storage.addressBook.entries[journal->count], &entry, sizeof(entry) );
+    }
+    else
+    {
+        return;
+    }
+
+    write_count( journal->count );
+    write_update( ADDRESS_BOOK_IDLE );
+}
+
+// the journal is complete before it is marked as under way
+static void start_update( address_book_update_e update, const address_book_journal_t* journal )
+{
+    nvm_write( (void*) &N_storage.addressBook.journal, (void*) journal, sizeof(*journal) );
+    write_update( update );
+    apply_journal();
+}
+
+const address_entry_t* address_book_find( const uint8_t* address )
+{
+    const address_book_t* addressBook = book();
+    const uint16_t index = lower_bound( addressBook, address );
+    if( index == addressBook->count || memcmp(addressBook->entries[index].address, address, XYM_ADDRESS_LENGTH) != 0 )
+    {
+        return NULL;
+    }
+    return &addressBook->entries[index];
+}
+
+bool address_book_add( const uint8_t* address, const char* label )
+{
+    const address_book_t* addressBook = book();
+    const uint16_t index = lower_bound( addressBook, address );
+    const bool known = index < addressBook->count && memcmp(addressBook->entries[index].address, address, XYM_ADDRESS_LENGTH) == 0;
+
+    if( !known && addressBook->count == MAX_ADDRESS_BOOK_ENTRIES )
+    {
+        return false;
+    }
+
+    // a rename moves nothing
+    address_book_journal_t journal;
+    memset( &journal, 0, sizeof(journal) );
+    journal.index = index;
+    journal.count = known ? addressBook->count : addressBook->count + 1;
+    journal.next  = known ? index : addressBook->count;
+    memcpy( journal.entry.address, address, XYM_ADDRESS_LENGTH );
+    strncpy( journal.entry.label, label, MAX_CONTACT_LABEL_LEN );
+
+    start_update( ADDRESS_BOOK_ADDING, &journal );
+    return true;
+}
+
+bool address_book_remove( const uint8_t* address )
+{
+    const address_book_t* addressBook = book();
+    const uint16_t index = lower_bound( addressBook, address );
+    if( index == addressBook->count || memcmp(addressBook->entries[index].address, address, XYM_ADDRESS_LENGTH) != 0 )
+    {
+        return false;
+    }
+
+    address_book_journal_t journal;
+    memset( &journal, 0, sizeof(journal) );
+    journal.index = index;
+    journal.count = addressBook->count - 1;
+    journal.next  = index;
+
+    start_update( ADDRESS_BOOK_REMOVING, &journal );
+    return true;
+}
+
+void address_book_recover( void )
+{
+    apply_journal();
+}
+
+uint16_t address_book_count( void )
+{
+    return book()->count;
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_ADDRESSBOOK_H
+#define LEDGER_APP_XYM_ADDRESSBOOK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "limitations.h"
+#include "xym/xym_helpers.h"
+
+/**
+ * Addresses the user has confirmed with a label, kept in N_storage and
+ * sorted by raw address. The review shows the label of a known address
+ * instead of its base32 form.
+ */
+
+typedef struct {
+    uint8_t address[XYM_ADDRESS_LENGTH];
+    char    label[MAX_CONTACT_LABEL_LEN + 1];   ///< printable ASCII, zero terminated
+} address_entry_t;
+
+typedef enum {
+    ADDRESS_BOOK_IDLE,
+    ADDRESS_BOOK_ADDING,        ///< an entry is added or renamed
+    ADDRESS_BOOK_REMOVING       ///< an entry is removed
+} address_book_update_e;
+
+/**
+ * Update under way, written before the first entry is moved so that one cut
+ * by a power loss can be finished by 'address_book_recover()'.
+ */
+typedef struct {
+    uint8_t         update;     ///< address_book_update_e, set once the rest is written, cleared once done
+    uint16_t        index;      ///< entry added, renamed or removed
+    uint16_t        count;      ///< number of entries once the update is done
+    uint16_t        next;       ///< next entry to be moved, written after each move
+    address_entry_t entry;      ///< entry written at 'index' when adding
+} address_book_journal_t;
+
+typedef struct {
+    uint16_t               count;
+    address_book_journal_t journal;
+    address_entry_t        entries[MAX_ADDRESS_BOOK_ENTRIES];
+} address_book_t;
+
+
+/**
+ * Binary search for a raw address, NULL when it is not in the book.
+ * The entry points into N_storage.
+ */
+const address_entry_t* address_book_find( const uint8_t* address );
+
+
+/**
+ * Stores 'address' with 'label', or renames it if already known.
+ * Returns false when the book is full.
+ */
+bool address_book_add( const uint8_t* address, const char* label );
+
+
+/**
+ * Returns false when 'address' is not in the book.
+ */
+bool address_book_remove( const uint8_t* address );
+
+
+uint16_t address_book_count( void );
+
+
+/**
+ * Finishes an update cut by a power loss, if any. Called when the app starts.
+ */
+void address_book_recover( void );
+
+#endif //LEDGER_APP_XYM_ADDRESSBOOK_H
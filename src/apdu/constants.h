@@ -25,6 +25,9 @@
 #define P2_CHAINCODE 0x01
 #define P1_MASK_ORDER 0x01u
 #define P1_MASK_MORE 0x80u
+#define P1_MASK_RESUME 0x20u
+#define P1_MASK_ACCOUNT_SLOT 0x10u
+#define P1_MASK_COSIGNATURE 0x08u
 #define P2_SECP256K1 0x40u
 #define P2_ED25519 0x80u
 
@@ -20,6 +20,13 @@
 #include "messages/get_public_key.h"
 #include "messages/sign_transaction.h"
 #include "messages/get_app_configuration.h"
+#include "messages/select_account.h"
+#include "messages/get_trace.h"
+#include "messages/get_stats.h"
+#include "messages/preview_transaction.h"
+#include "messages/edit_address_book.h"
+#include "trace.h"
+#include "stats.h"
 
 unsigned char lastINS = 0;
 
@@ -30,6 +37,24 @@ int handle_apdu( const ApduCommand_t* cmd )
     return handle_error( UNKNOWN_INSTRUCTION_CLASS );
   }
 
+  stats_apdu( cmd->ins );
+
+  // reading the stats does not interrupt a signing session
+  if( cmd->ins == GET_STATS )
+  {
+    return handle_get_stats( cmd );
+  }
+
+#ifdef HAVE_TRACE
+  // reading the trace is neither traced nor part of a signing session
+  if( cmd->ins == GET_TRACE )
+  {
+    return handle_get_trace( cmd );
+  }
+#endif
+
+  TRACE( TRACE_APDU_RECEIVED, cmd->ins );
+
   // Reset transaction context before starting to parse a new APDU message type.
   // This helps protect against "Instruction Change" attacks
   if( cmd->ins != lastINS )
@@ -55,6 +80,21 @@ int handle_apdu( const ApduCommand_t* cmd )
     {
       return handle_app_configuration( );
     }
+
+    case SELECT_ACCOUNT:
+    {
+      return handle_select_account( cmd );
+    }
+
+    case PREVIEW_TX:
+    {
+      return handle_preview( cmd );
+    }
+
+    case EDIT_ADDRESS_BOOK:
+    {
+      return handle_edit_address_book( cmd );
+    }
          
     default:
     {
@@ -15,23 +15,52 @@
 *  See the License for the specific language governing permissions and
 *  limitations under the License.
 ********************************************************************************/
+#include <stddef.h>
 #include "global.h"
 #include "messages/sign_transaction.h"
+#include "messages/select_account.h"
 #include "io.h"
+#include "arena.h"
 
 transaction_context_t transactionContext;
 sign_state_e signState;
 
 void reset_transaction_context()
 {
-    explicit_bzero(&transactionContext, sizeof(transaction_context_t));
-    explicit_bzero(&fields, sizeof(fields_array_t));
+    // wipe up to the high-water marks, rawTx is the last member
+    explicit_bzero(transactionContext.rawTx, transactionContext.rawTxUsed);
+    explicit_bzero(&transactionContext, offsetof(transaction_context_t, rawTx));
+    arena_enter(ARENA_IDLE);
+    reset_upload_session();
     signState = IDLE;
 }
 
+void transaction_hash( uint8_t* out )
+{
+    cx_sha3_t hash;
+    memcpy( &hash, &transactionContext.rawTxHash, sizeof(hash) );
+    cx_hash( &hash.header, CX_LAST, NULL, 0, out, XYM_TRANSACTION_HASH_LENGTH );
+    explicit_bzero( &hash, sizeof(hash) );
+}
+
+void suspend_transaction_context()
+{
+    if( signState == WAITING_FOR_MORE || signState == UPLOAD_SUSPENDED )
+    {
+        suspend_upload_session();
+        signState = UPLOAD_SUSPENDED;
+    }
+    else
+    {
+        reset_transaction_context();
+    }
+}
+
 
 int handle_error( ApduResponse_t errorCode ) 
 {
+    // the host has to select its accounts again after any error
+    reset_account_slots();
     reset_transaction_context();
     return io_send_error( errorCode );
 }
\ No newline at end of file
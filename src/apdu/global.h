@@ -33,25 +33,55 @@ typedef enum {
     IDLE,
     WAITING_FOR_MORE,
     PENDING_REVIEW,
+    UPLOAD_SUSPENDED,
+    PREVIEW_READY,      ///< parsed for PREVIEW_TX, its screens are being read back
 } sign_state_e;
 
 typedef struct {
     uint8_t pathLength;
     uint32_t bip32Path[MAX_BIP32_PATH];
-    uint8_t rawTx[MAX_RAW_TX];
     uint32_t rawTxLength;
     uint8_t curve;
+    uint16_t chunkCount;      ///< chunks received so far
+    uint32_t rawTxUsed;       ///< high-water mark of rawTx, the rest of it is always zero
+    bool cosignature;         ///< the host asks for the cosignature of a hash, see P1_MASK_COSIGNATURE
+    cx_sha3_t rawTxHash;      ///< running SHA3-256 of the received transaction bytes, see 'transaction_hash()'
+    uint8_t rawTx[MAX_RAW_TX]; ///< must stay last, see 'reset_transaction_context()'
 } transaction_context_t;
 
 extern transaction_context_t transactionContext;
 extern sign_state_e signState;
 
+/**
+ * Wipes the transaction context and the arena. Only the part of the
+ * raw transaction that has been written since the last reset is
+ * cleared, the rest is still zero.
+ * 
+ */
 void reset_transaction_context();
 
 
 /**
- * Resets the transaction context and send an error reponse 
- * to host.
+ * SHA3-256 of the transaction bytes received so far, updated with every
+ * packet so that it is ready as soon as the last one is in. Finalizes a
+ * copy, the running hash keeps absorbing the rest of the upload.
+ * 
+ */
+void transaction_hash( uint8_t* out );
+
+
+/**
+ * Called after a transport reset. An upload that is still waiting
+ * for more data is suspended, so that the host can resume it once
+ * reconnected, anything else is reset.
+ * 
+ */
+void suspend_transaction_context();
+
+
+/**
+ * Resets the transaction context and the selected accounts and
+ * send an error reponse to host.
  * 
  */
 int handle_error( ApduResponse_t errorCode );
@@ -0,0 +1,145 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "edit_address_book.h"
+#include <os.h>
+#include "io.h"
+#include "apdu/global.h"
+#include "address_book.h"
+#include "base32.h"
+#include "arena.h"
+#include "ui/main/idle_menu.h"
+#include "ui/address/address_ui.h"
+
+
+static bool valid_label( const uint8_t* label, uint8_t length )
+{
+    if( length == 0 || length > MAX_CONTACT_LABEL_LEN )
+    {
+        return false;
+    }
+    for( uint8_t i = 0; i < length; i++ )
+    {
+        if( label[i] < 0x20 || label[i] > 0x7E )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static ApduResponse_t extract_contact( const ApduCommand_t* cmd )
+{
+    if( (cmd->p1 != P1_CONTACT_ADD && cmd->p1 != P1_CONTACT_REMOVE) || cmd->p2 != 0 )
+    {
+        return INVALID_P1_OR_P2;
+    }
+
+    const bool remove = (cmd->p1 == P1_CONTACT_REMOVE);
+    if( cmd->lc < XYM_ADDRESS_LENGTH || (remove && cmd->lc != XYM_ADDRESS_LENGTH) )
+    {
+        return WRONG_APDU_DATA_LENGTH;
+    }
+
+    const uint8_t network = cmd->data[0];
+    if( network != MAINNET_NETWORK_TYPE && network != TESTNET_NETWORK_TYPE )
+    {
+        return INVALID_CONTACT;
+    }
+
+    const bool known = (address_book_find( cmd->data ) != NULL);
+    if( remove )
+    {
+        if( !known )
+        {
+            return INVALID_CONTACT;
+        }
+    }
+    else
+    {
+        const uint8_t labelLength = cmd->lc - XYM_ADDRESS_LENGTH;
+        if( !valid_label( cmd->data + XYM_ADDRESS_LENGTH, labelLength ) )
+        {
+            return INVALID_CONTACT;
+        }
+        if( !known && address_book_count() == MAX_ADDRESS_BOOK_ENTRIES )
+        {
+            return ADDRESS_BOOK_FULL;
+        }
+        memcpy( G_arena.contact.label, cmd->data + XYM_ADDRESS_LENGTH, labelLength );
+        G_arena.contact.label[labelLength] = '\0';
+    }
+
+    G_arena.contact.remove = remove;
+    strlcpy( G_arena.contact.action, remove ? "Remove" : (known ? "Rename" : "Add"), sizeof(G_arena.contact.action) );
+    memcpy( G_arena.contact.address, cmd->data, XYM_ADDRESS_LENGTH );
+    base32_encode( G_arena.contact.address, XYM_ADDRESS_LENGTH, G_arena.contact.prettyAddress, XYM_PRETTY_ADDRESS_LENGTH );
+    G_arena.contact.prettyAddress[XYM_PRETTY_ADDRESS_LENGTH] = '\0';
+    return OK;
+}
+
+
+/**
+ * Ledger Bolos callback for when user approves the change
+ */
+static void on_contact_approved()
+{
+    // checked again, the book is in flash and only this flow writes to it
+    const bool done = G_arena.contact.remove ? address_book_remove( G_arena.contact.address )
+                                             : address_book_add( G_arena.contact.address, G_arena.contact.label );
+    arena_enter( ARENA_IDLE );
+
+    if( !done )
+    {
+        io_send_error( INTERNAL_ERROR );
+    }
+    else
+    {
+        size_t tx = 0;
+        write_u16_be( G_io_apdu_buffer, tx, address_book_count() );
+        tx += 2;
+        buffer_t buffer = { G_io_apdu_buffer, tx, 0 };
+        io_send_response( &buffer, OK );
+    }
+    display_idle_menu();
+}
+
+
+/**
+ * Ledger Bolos callback for when user rejects the change
+ */
+static void on_contact_rejected()
+{
+    arena_enter( ARENA_IDLE );
+    io_send_error( ADDRESS_REJECTED );
+    display_idle_menu();
+}
+
+
+int handle_edit_address_book( const ApduCommand_t* cmd )
+{
+    arena_enter( ARENA_CONTACT );
+    const ApduResponse_t result = extract_contact( cmd );
+    if( OK != result )
+    {
+        arena_enter( ARENA_IDLE );
+        return handle_error( result );
+    }
+
+    display_contact_confirmation_ui( on_contact_approved, on_contact_rejected );
+    return 0; ///< this will make the 'io_receive()' call in the main loop block until user either confirms or rejects the change.
+}
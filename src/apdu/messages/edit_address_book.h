@@ -0,0 +1,41 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_EDITADDRESSBOOK_H
+#define LEDGER_APP_XYM_EDITADDRESSBOOK_H
+
+#include "types.h"
+
+#define P1_CONTACT_ADD    0x00u   ///< add the address, or rename it if it is known
+#define P1_CONTACT_REMOVE 0x01u
+
+/**
+ * Changes the address book once the user has approved it on the device.
+ *
+ * CDATA is the raw address (24 bytes) followed, to add or rename it, by its
+ * label: 1 to MAX_CONTACT_LABEL_LEN printable ASCII characters, no
+ * terminator. The response is the number of entries (2 bytes, big endian).
+ *
+ * @param[in] cmd
+ *   Structured APDU command (CLA, INS, P1, P2, Lc, Command data).
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handle_edit_address_book( const ApduCommand_t* cmd );
+
+#endif //LEDGER_APP_XYM_EDITADDRESSBOOK_H
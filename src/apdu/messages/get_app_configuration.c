@@ -31,6 +31,6 @@ int handle_app_configuration( )
     data[2] = LEDGER_MINOR_VERSION;
     data[3] = LEDGER_PATCH_VERSION;
 
-    buffer_t buffer = { data, 4, 0 };
+    buffer_t buffer = { data, sizeof(data), 0 };
     return io_send_response( &buffer, OK );
 }
@@ -16,6 +16,7 @@
 *  limitations under the License.
 ********************************************************************************/
 #include "get_public_key.h"
+#include <os_io_seproxyhal.h>
 #include "apdu/global.h"
 #include "xym/xym_helpers.h"
 #include "ui/main/idle_menu.h"
@@ -23,17 +24,8 @@
 #include "types.h"
 #include "io.h"
 #include "crypto.h"
-
-uint8_t G_xym_public_key[ XYM_PUBLIC_KEY_LENGTH ];
-
-typedef struct 
-{
-    bool        confirmTransaction;
-    uint8_t     bip32PathLength;
-    uint32_t    bip32Path[ MAX_BIP32_PATH ];
-    uint8_t     networkType;
-    CurveType_t curveType;
-} KeyData_t;
+#include "arena.h"
+#include "select_account.h"
 
 
 /**
@@ -43,7 +35,7 @@ int send_public_key()
 {
     size_t tx = 0;
     G_io_apdu_buffer[tx++] = XYM_PUBLIC_KEY_LENGTH;
-    memcpy(G_io_apdu_buffer + tx, G_xym_public_key, XYM_PUBLIC_KEY_LENGTH);
+    memcpy(G_io_apdu_buffer + tx, G_arena.publicKey.key, XYM_PUBLIC_KEY_LENGTH);
     tx += XYM_PUBLIC_KEY_LENGTH;
     buffer_t buffer = { G_io_apdu_buffer, tx, 0 };
 
@@ -177,9 +169,18 @@ int handle_public_key( const ApduCommand_t* cmd )
         return handle_error(result);
     }
 
-    // get the public key
+    // the key of a selected account was derived by SELECT_ACCOUNT, the network type only changes the address
+    const account_slot_t* account = find_account_slot( keyData.bip32Path, keyData.bip32PathLength, keyData.curveType );
+    arena_enter( ARENA_PUBLIC_KEY );
+    if( !keyData.confirmTransaction && account != NULL )
+    {
+        memcpy( G_arena.publicKey.key, account->publicKey, XYM_PUBLIC_KEY_LENGTH );
+        return send_public_key();
+    }
+
+    // get the public key, it is kept in the arena until the user has confirmed the address
     char address[ XYM_PRETTY_ADDRESS_LENGTH+1 ];
-    get_public_key( &keyData, G_xym_public_key, address );
+    get_public_key( &keyData, G_arena.publicKey.key, address );
 
     // send public key or ask for user confirmation
     if( !keyData.confirmTransaction ) 
@@ -19,8 +19,34 @@
 #define LEDGER_APP_XYM_GETPUBLICKEY_H
 
 #include "types.h"
+#include "limitations.h"
+#include "xym/xym_helpers.h"
+#include "crypto.h"
 
 
+typedef struct 
+{
+    bool        confirmTransaction;
+    uint8_t     bip32PathLength;
+    uint32_t    bip32Path[ MAX_BIP32_PATH ];
+    uint8_t     networkType;
+    CurveType_t curveType;
+} KeyData_t;
+
+
+/**
+ * Extracts key data used for calculating public key, from APDU parameters, and returns it in 'keyData'.
+ * 
+ */
+ApduResponse_t extract_parameters( const uint8_t p1, const uint8_t p2, uint8_t* data, const uint8_t dataLength, KeyData_t* keyData );
+
+
+/**
+ * Calculates and returns a public key which corresponds to bip32 path in 'keyData'
+ * 
+ */
+void get_public_key( KeyData_t* keyData, uint8_t key[ XYM_PUBLIC_KEY_LENGTH ], char address[ XYM_PRETTY_ADDRESS_LENGTH+1 ] );
+
 
 /**
  * Processes the APDU command, extracts the key data and displays 
@@ -0,0 +1,57 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "get_stats.h"
+#include <os.h>
+#include "io.h"
+#include "apdu/global.h"
+#include "stats.h"
+
+int handle_get_stats( const ApduCommand_t* cmd )
+{
+    if( cmd->p1 != 0 || cmd->p2 != 0 )
+    {
+        return handle_error( INVALID_P1_OR_P2 );
+    }
+
+    size_t tx = 0;
+    G_io_apdu_buffer[tx++] = STATS_INS_COUNT;
+    for( uint8_t i = 0; i < STATS_INS_COUNT; i++ )
+    {
+        G_io_apdu_buffer[tx++] = STATS_INSTRUCTIONS[i];
+        write_u32_be( G_io_apdu_buffer, tx, G_stats.insCount[i] );
+        tx += 4;
+    }
+
+    G_io_apdu_buffer[tx++] = STATS_RESPONSE_COUNT;
+    for( uint8_t i = 0; i < STATS_RESPONSE_COUNT; i++ )
+    {
+        write_u16_be( G_io_apdu_buffer, tx, STATS_RESPONSES[i] );
+        tx += 2;
+        write_u32_be( G_io_apdu_buffer, tx, G_stats.errorCount[i] );
+        tx += 4;
+    }
+
+    write_u32_be( G_io_apdu_buffer, tx, G_stats.maxRawTxLength );
+    tx += 4;
+    G_io_apdu_buffer[tx++] = G_stats.maxFieldCount;
+    write_u32_be( G_io_apdu_buffer, tx, G_stats.signatureCount );
+    tx += 4;
+
+    buffer_t buffer = { G_io_apdu_buffer, tx, 0 };
+    return io_send_response( &buffer, OK );
+}
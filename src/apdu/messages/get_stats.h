@@ -0,0 +1,36 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_GETSTATS_H
+#define LEDGER_APP_XYM_GETSTATS_H
+
+#include "types.h"
+
+/**
+ * Sends the counters of 'stats.h'. Reading them does not interrupt a
+ * signing session.
+ *
+ * Response: INS bucket count (1) | per bucket INS (1) and APDUs received (4) |
+ * status word bucket count (1) | per bucket status word (2) and responses
+ * sent (4) | max raw transaction length (4) | max field count (1) |
+ * signatures (4) | clock period in us (4) | derivation ticks (4) |
+ * signing ticks (4). All numbers are big endian, INS 0x00 and status word
+ * 0x0000 are the buckets for everything else.
+ */
+int handle_get_stats( const ApduCommand_t* cmd );
+
+#endif //LEDGER_APP_XYM_GETSTATS_H
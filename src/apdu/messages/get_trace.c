@@ -0,0 +1,69 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifdef HAVE_TRACE
+
+#include "get_trace.h"
+#include <os.h>
+#include "io.h"
+#include "apdu/global.h"
+#include "trace.h"
+#include "stats.h"
+
+int handle_get_trace( const ApduCommand_t* cmd )
+{
+    if( cmd->p2 != 0 && cmd->p2 != P2_TRACE_CLEAR )
+    {
+        return handle_error( INVALID_P1_OR_P2 );
+    }
+
+    // sending the chunk must not add records to the ring being read
+    trace_pause( true );
+
+    size_t tx = 0;
+    write_u32_be( G_io_apdu_buffer, tx, STATS_CLOCK_PERIOD_US );
+    tx += 4;
+    write_u32_be( G_io_apdu_buffer, tx, trace_total() );
+    tx += 4;
+    write_u16_be( G_io_apdu_buffer, tx, trace_size() );
+    tx += 2;
+
+    const uint16_t first = (uint16_t) cmd->p1 * TRACE_RECORDS_PER_APDU;
+    for( uint16_t i = first; i < first + TRACE_RECORDS_PER_APDU && i < trace_size(); i++ )
+    {
+        const trace_record_t* record = trace_record( i );
+        write_u32_be( G_io_apdu_buffer, tx, record->tick );
+        tx += 4;
+        write_u16_be( G_io_apdu_buffer, tx, record->arg );
+        tx += 2;
+        G_io_apdu_buffer[tx++] = record->event;
+        G_io_apdu_buffer[tx++] = record->sequence;
+    }
+
+    if( cmd->p2 == P2_TRACE_CLEAR )
+    {
+        trace_clear();
+    }
+
+    buffer_t buffer = { G_io_apdu_buffer, tx, 0 };
+    const int ret = io_send_response( &buffer, OK );
+
+    trace_pause( false );
+    return ret;
+}
+
+#endif // HAVE_TRACE
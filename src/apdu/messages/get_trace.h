@@ -0,0 +1,37 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_GETTRACE_H
+#define LEDGER_APP_XYM_GETTRACE_H
+
+#include "types.h"
+
+#define TRACE_RECORDS_PER_APDU 30
+#define P2_TRACE_CLEAR 0x01
+
+/**
+ * Sends the records P1 * TRACE_RECORDS_PER_APDU onwards of the trace ring,
+ * oldest first, and clears the ring afterwards if P2 is P2_TRACE_CLEAR.
+ *
+ * Response: clock period in us (4) | records written (4) | records in the
+ * ring (2) | records, each tick (4) | arg (2) | event (1) | sequence (1).
+ * All numbers are big endian, a chunk with less than
+ * TRACE_RECORDS_PER_APDU records is the last one.
+ */
+int handle_get_trace( const ApduCommand_t* cmd );
+
+#endif //LEDGER_APP_XYM_GETTRACE_H
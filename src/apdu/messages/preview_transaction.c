@@ -0,0 +1,126 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "preview_transaction.h"
+#include <os.h>
+#include "io.h"
+#include "apdu/global.h"
+#include "sign_transaction.h"
+#include "ui/transaction/review_menu.h"
+#include "arena.h"
+
+typedef struct
+{
+    uint8_t  item;    ///< field of the record being sent
+    uint8_t  page;    ///< page of that field
+    uint16_t offset;  ///< bytes of the record already sent
+} preview_cursor_t;
+
+static preview_cursor_t previewCursor;
+
+// renders the screen under the cursor into the review arena, returns the size of its record
+static uint16_t render_record( void )
+{
+    const field_t* field = &G_arena.review.fields.arr[previewCursor.item];
+    review_page_title( field, previewCursor.page, G_arena.review.fieldName );
+    review_page_value( field, previewCursor.page, G_arena.review.fieldValue );
+
+    return 2 + strlen( G_arena.review.fieldName ) + strlen( G_arena.review.fieldValue );
+}
+
+static uint8_t record_byte( uint16_t index )
+{
+    const uint8_t labelLength = (uint8_t) strlen( G_arena.review.fieldName );
+    if( index == 0 )
+    {
+        return labelLength;
+    }
+    if( index <= labelLength )
+    {
+        return (uint8_t) G_arena.review.fieldName[index - 1];
+    }
+    if( index == labelLength + 1 )
+    {
+        return (uint8_t) strlen( G_arena.review.fieldValue );
+    }
+    return (uint8_t) G_arena.review.fieldValue[index - labelLength - 2];
+}
+
+static ApduResponse_t send_chunk( void )
+{
+    const fields_array_t* fields = &G_arena.review.fields;
+
+    size_t tx = 1;
+    while( previewCursor.item < fields->numFields && tx < PREVIEW_CHUNK_SIZE )
+    {
+        // a record cut by the previous chunk is rendered again, the formatting is deterministic
+        const uint16_t recordSize = render_record();
+        while( previewCursor.offset < recordSize && tx < PREVIEW_CHUNK_SIZE )
+        {
+            G_io_apdu_buffer[tx++] = record_byte( previewCursor.offset++ );
+        }
+        if( previewCursor.offset < recordSize )
+        {
+            break;
+        }
+
+        previewCursor.offset = 0;
+        if( ++previewCursor.page >= review_page_count( &fields->arr[previewCursor.item] ) )
+        {
+            previewCursor.page = 0;
+            previewCursor.item++;
+        }
+    }
+
+    const bool more = previewCursor.item < fields->numFields;
+    G_io_apdu_buffer[0] = more ? 1 : 0;
+
+    buffer_t buffer = { G_io_apdu_buffer, tx, 0 };
+    const int succ = io_send_response( &buffer, OK );
+    if( !more )
+    {
+        reset_transaction_context();
+    }
+    return ( (succ != -1) ? OK : INTERNAL_ERROR );
+}
+
+ApduResponse_t start_preview( void )
+{
+    explicit_bzero( &previewCursor, sizeof(previewCursor) );
+    return send_chunk();
+}
+
+int handle_preview( const ApduCommand_t* cmd )
+{
+    if( signState != PREVIEW_READY )
+    {
+        // the follow-up commands only make sense once the upload is parsed
+        return (cmd->p1 == P1_PREVIEW_NEXT) ? handle_error( INVALID_SIGNING_PACKET_ORDER ) : handle_upload( cmd, true );
+    }
+
+    if( cmd->p1 != P1_PREVIEW_NEXT || cmd->p2 != 0 )
+    {
+        return handle_error( INVALID_P1_OR_P2 );
+    }
+
+    const ApduResponse_t result = send_chunk();
+    if( OK != result )
+    {
+        return handle_error( result );
+    }
+    return 0;
+}
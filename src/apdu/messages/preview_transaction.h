@@ -0,0 +1,49 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_PREVIEWTRANSACTION_H
+#define LEDGER_APP_XYM_PREVIEWTRANSACTION_H
+
+#include "types.h"
+
+#define PREVIEW_CHUNK_SIZE 250   ///< response data of one chunk, the flag byte included
+#define P1_PREVIEW_NEXT    0x02u
+
+/**
+ * Uploads a transaction exactly like SIGN_TX (same P1, P2 and CDATA). Once
+ * the last packet is in, the transaction is parsed and, instead of being
+ * reviewed, the screens the user would see are sent back. No key is derived
+ * and nothing is signed.
+ *
+ * Every answer to the last packet and to the following PREVIEW_TX commands
+ * with P1 = P1_PREVIEW_NEXT (no CDATA) is a chunk of at most
+ * PREVIEW_CHUNK_SIZE bytes: more chunks follow (1, 0 or 1) | screens.
+ * The screens, concatenated over the chunks, are records of label length (1)
+ * | label | value length (1) | value, in review order. A field split into
+ * pages gives one record per page, labelled "Label (k/n)" as on the device.
+ * The context is reset after the last chunk.
+ */
+int handle_preview( const ApduCommand_t* cmd );
+
+
+/**
+ * Called by the upload once the transaction is parsed into
+ * 'G_arena.review.fields', sends the first chunk.
+ */
+ApduResponse_t start_preview( void );
+
+#endif //LEDGER_APP_XYM_PREVIEWTRANSACTION_H
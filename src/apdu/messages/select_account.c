@@ -0,0 +1,92 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "select_account.h"
+#include "get_public_key.h"
+#include "apdu/global.h"
+#include "io.h"
+
+static account_slot_t accountSlots[ MAX_ACCOUNT_SLOTS ];
+
+
+const account_slot_t* get_account_slot( uint8_t slot )
+{
+    if( slot >= MAX_ACCOUNT_SLOTS || !accountSlots[slot].used )
+    {
+        return NULL;
+    }
+
+    return &accountSlots[slot];
+}
+
+const account_slot_t* find_account_slot( const uint32_t* bip32Path, uint8_t pathLength, CurveType_t curve )
+{
+    for( uint8_t slot = 0; slot < MAX_ACCOUNT_SLOTS; slot++ )
+    {
+        const account_slot_t* account = &accountSlots[slot];
+        if( account->used && account->curve == curve && account->pathLength == pathLength &&
+            memcmp(account->bip32Path, bip32Path, pathLength * sizeof(uint32_t)) == 0 )
+        {
+            return account;
+        }
+    }
+
+    return NULL;
+}
+
+void reset_account_slots()
+{
+    explicit_bzero( accountSlots, sizeof(accountSlots) );
+}
+
+
+int handle_select_account( const ApduCommand_t* cmd )
+{
+    if( cmd->p1 >= MAX_ACCOUNT_SLOTS )
+    {
+        return handle_error( INVALID_P1_OR_P2 );
+    }
+
+    // same data as GET_PUBLIC_KEY, the key is never confirmed by the user
+    KeyData_t keyData;
+    const ApduResponse_t result = extract_parameters( P1_NON_CONFIRM, cmd->p2, cmd->data, cmd->lc, &keyData );
+    if( OK != result )
+    {
+        return handle_error( result );
+    }
+
+    account_slot_t* account = &accountSlots[cmd->p1];
+    explicit_bzero( account, sizeof(account_slot_t) );
+
+    // derive the public key once for the whole session
+    char address[ XYM_PRETTY_ADDRESS_LENGTH+1 ];
+    get_public_key( &keyData, account->publicKey, address );
+
+    memcpy( account->bip32Path, keyData.bip32Path, sizeof(account->bip32Path) );
+    account->pathLength = keyData.bip32PathLength;
+    account->curve      = keyData.curveType;
+    account->used       = true;
+
+    // send public key
+    size_t tx = 0;
+    G_io_apdu_buffer[tx++] = XYM_PUBLIC_KEY_LENGTH;
+    memcpy(G_io_apdu_buffer + tx, account->publicKey, XYM_PUBLIC_KEY_LENGTH);
+    tx += XYM_PUBLIC_KEY_LENGTH;
+    buffer_t buffer = { G_io_apdu_buffer, tx, 0 };
+
+    return io_send_response( &buffer, OK );
+}
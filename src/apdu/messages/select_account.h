@@ -0,0 +1,77 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_SELECTACCOUNT_H
+#define LEDGER_APP_XYM_SELECTACCOUNT_H
+
+#include "types.h"
+#include "limitations.h"
+#include "xym/xym_helpers.h"
+#include "crypto.h"
+
+
+/**
+ * An account pinned by SELECT_ACCOUNT, SIGN_TX can refer to it by
+ * its slot instead of sending the bip32 path.
+ */
+typedef struct 
+{
+    bool        used;
+    uint8_t     pathLength;
+    uint32_t    bip32Path[ MAX_BIP32_PATH ];
+    CurveType_t curve;
+    uint8_t     publicKey[ XYM_PUBLIC_KEY_LENGTH ];   ///< answers GET_PUBLIC_KEY without confirmation for the same path
+} account_slot_t;
+
+
+/**
+ * Processes the APDU command, derives the public key of the bip32 path
+ * and pins both to the account slot given in P1.
+ *
+ * @param[in] cmd
+ *   Structured APDU command (CLA, INS, P1, P2, Lc, Command data).
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handle_select_account( const ApduCommand_t* cmd );
+
+
+/**
+ * Returns the account pinned to 'slot', NULL if there is none.
+ * 
+ */
+const account_slot_t* get_account_slot( uint8_t slot );
+
+
+/**
+ * Returns the account pinned with this bip32 path and curve, NULL if there
+ * is none.
+ * 
+ */
+const account_slot_t* find_account_slot( const uint32_t* bip32Path, uint8_t pathLength, CurveType_t curve );
+
+
+/**
+ * Forgets all pinned accounts. Must be called whenever the host
+ * session ends (transport reset, error response).
+ * 
+ */
+void reset_account_slots();
+
+
+#endif //LEDGER_APP_XYM_SELECTACCOUNT_H
@@ -17,6 +17,7 @@
 ********************************************************************************/
 #include "sign_transaction.h"
 #include <os.h>
+#include <os_io_seproxyhal.h>
 #include "global.h"
 #include "xym/xym_helpers.h"
 #include "ui/main/idle_menu.h"
@@ -24,15 +25,62 @@
 #include "printers.h"
 #include "io.h"
 #include "crypto.h"
+#include "select_account.h"
+#include "arena.h"
+#include "trace.h"
+#include "stats.h"
+#include "preview_transaction.h"
 
 #define PREFIX_LENGTH   4
 
-buffer_t        rawTxData;  ///< transaction data is extracted from this buffer 
-fields_array_t  fields;     ///< extracted data from rawTxData is used to fill this structure, which is displayed to user for confirmation
+#define UPLOAD_SESSION_ID_LENGTH    4
+#define UPLOAD_RESUME_TIMEOUT_TICKS 100 ///< ticker events are 100ms apart
+
+typedef struct
+{
+    uint8_t   id[UPLOAD_SESSION_ID_LENGTH]; ///< returned with every acknowledgement of the upload
+    uint16_t  ticksLeft;                    ///< until a suspended upload is dropped
+} upload_session_t;
+
+buffer_t        rawTxData;  ///< transaction data is extracted from this buffer into 'G_arena.review.fields', which are displayed to user for confirmation
+
+static upload_session_t uploadSession;
+static bool             previewUpload;  ///< the upload comes from PREVIEW_TX, it is parsed but never reviewed nor signed
 
 ApduResponse_t handle_packet_content( const buffer_t* buffer, const bool lastPacket );
 
 
+static bool is_mainnet_path( void )
+{
+    // checks if the coin_type field of bip32 path is 'symbol'
+    return (transactionContext.bip32Path[1] & 0x7FFFFFFF) == 4343;
+}
+
+static ApduResponse_t parser_response( int status )
+{
+    switch( status )
+    {
+        case E_SUCCESS:
+        {
+            return OK;
+        }
+        case E_TOO_MANY_FIELDS:
+        {
+            // Abort if there are too many fields to show on Ledger device
+            return TOO_MANY_TRANSACTION_FIELDS;
+        }
+        case E_DATA_TOO_LARGE:
+        {
+            return SIGNING_DATA_TOO_LARGE;
+        }
+        default: // E_NOT_ENOUGH_DATA, E_INVALID_DATA
+        {
+            return INVALID_SIGNING_DATA;
+        }
+    }
+}
+
+
 void sign_transaction()
 {
     if( signState != PENDING_REVIEW ) 
@@ -50,7 +98,6 @@ void sign_transaction()
     }
 
     cx_ecfp_private_key_t privateKey;
-    unsigned char signature[IO_APDU_BUFFER_SIZE];
     uint32_t sigLength = 0;
 
     io_seproxyhal_io_heartbeat();
@@ -63,10 +110,13 @@ void sign_transaction()
             crypto_derive_private_key( transactionContext.bip32Path, transactionContext.pathLength, transactionContext.curve, &privateKey );
             io_seproxyhal_io_heartbeat();
 
-            // sign transaction
+            // sign transaction, the signature is written straight into the response
+            TRACE( TRACE_SIGN_BEGIN, transactionContext.rawTxLength );
             sigLength = (uint32_t) cx_eddsa_sign( &privateKey, CX_LAST, CX_SHA512, transactionContext.rawTx,
-                                                   transactionContext.rawTxLength, NULL, 0, signature,
-                                                   IO_APDU_BUFFER_SIZE, NULL );
+                                                   transactionContext.rawTxLength, NULL, 0, G_io_apdu_buffer,
+                                                   IO_APDU_BUFFER_SIZE - 2, NULL );
+            G_stats.signatureCount++;
+            TRACE( TRACE_SIGN_END, sigLength );
         }
         CATCH_OTHER(e) 
         {
@@ -83,9 +133,8 @@ void sign_transaction()
     END_TRY;
 
     // send response
-    buffer_t response = { signature, sigLength, 0 };
+    buffer_t response = { G_io_apdu_buffer, sigLength, 0 };
     io_send_response( &response, OK );
-    explicit_bzero( signature,   sizeof(signature)  );
 
     // Display back the original UX
     display_idle_menu();
@@ -117,6 +166,66 @@ bool hasMore(uint8_t p1)
 	return (p1 & P1_MASK_MORE) != 0;
 }
 
+bool isResume(uint8_t p1) 
+{
+	return (p1 & P1_MASK_RESUME) != 0;
+}
+
+bool isAccountSlot(uint8_t p1) 
+{
+	return (p1 & P1_MASK_ACCOUNT_SLOT) != 0;
+}
+
+bool isCosignature(uint8_t p1) 
+{
+	return (p1 & P1_MASK_COSIGNATURE) != 0;
+}
+
+void reset_upload_session()
+{
+    explicit_bzero( &uploadSession, sizeof(uploadSession) );
+}
+
+void suspend_upload_session()
+{
+    uploadSession.ticksLeft = UPLOAD_RESUME_TIMEOUT_TICKS;
+}
+
+void tick_upload_session()
+{
+    if( signState == UPLOAD_SUSPENDED && uploadSession.ticksLeft > 0 && --uploadSession.ticksLeft == 0 )
+    {
+        reset_transaction_context();
+    }
+}
+
+ApduResponse_t handle_resume_query( const ApduCommand_t* cmd )
+{
+    // only the host that started the upload knows its session id
+    if( cmd->lc != UPLOAD_SESSION_ID_LENGTH || memcmp(cmd->data, uploadSession.id, UPLOAD_SESSION_ID_LENGTH) != 0 )
+    {
+        return INVALID_SIGNING_PACKET_ORDER;
+    }
+
+    // response: received length (4 bytes) | received chunks (2 bytes) | SHA3-256 of the received data
+    uint8_t response[4 + 2 + XYM_TRANSACTION_HASH_LENGTH];
+    response[0] = 0;
+    response[1] = 0;
+    response[2] = (uint8_t) (transactionContext.rawTxLength >> 8);
+    response[3] = (uint8_t) (transactionContext.rawTxLength & 0xFF);
+    response[4] = (uint8_t) (transactionContext.chunkCount >> 8);
+    response[5] = (uint8_t) (transactionContext.chunkCount & 0xFF);
+
+    transaction_hash( &response[6] );
+
+    uploadSession.ticksLeft = 0;
+    signState = WAITING_FOR_MORE;
+
+    buffer_t buffer = { response, sizeof(response), 0 };
+    const int succ = io_send_response( &buffer, OK );
+    return ( (succ != -1) ? OK : INTERNAL_ERROR );
+}
+
 ApduResponse_t handle_first_packet( const ApduCommand_t* cmd ) 
 {
     // check that its the first packet
@@ -128,27 +237,59 @@ ApduResponse_t handle_first_packet( const ApduCommand_t* cmd )
     // Reset old transaction data that might still remain
     reset_transaction_context();
 
-    // check that p2 is set to either SECP256K1 or ED25519
-    if( ( ((cmd->p2 & P2_SECP256K1) == 0) && ((cmd->p2 & P2_ED25519) == 0) ) ||
-        ( ((cmd->p2 & P2_SECP256K1) != 0) && ((cmd->p2 & P2_ED25519) != 0) )    )
-    {
-        return INVALID_P1_OR_P2;
-    }
+    // a new upload session, its id lets the host resume the upload after a transport reset
+    cx_rng( uploadSession.id, UPLOAD_SESSION_ID_LENGTH );
+    cx_sha3_init( &transactionContext.rawTxHash, 256 );
+    arena_enter( ARENA_UPLOAD );
+    transactionContext.cosignature = isCosignature(cmd->p1);
 
-    // convert apdu data to bip32 path
-    const buffer_t buffer = { cmd->data, cmd->lc, 0 };
-    transactionContext.pathLength = buffer_get_bip32_path( &buffer, transactionContext.bip32Path );
-    if( 0 == transactionContext.pathLength )
+    size_t bip32PathSize;
+    if( isAccountSlot(cmd->p1) )
     {
-        return INVALID_BIP32_PATH_LENGTH;
+        // path and curve were pinned by SELECT_ACCOUNT, the packet only carries the slot
+        const account_slot_t* account = (cmd->lc > 0) ? get_account_slot( cmd->data[0] ) : NULL;
+        if( account == NULL )
+        {
+            return INVALID_P1_OR_P2;
+        }
+
+        memcpy( transactionContext.bip32Path, account->bip32Path, sizeof(transactionContext.bip32Path) );
+        transactionContext.pathLength = account->pathLength;
+        transactionContext.curve      = account->curve;
+        bip32PathSize = 1;
     }
-    
-    // set curve
-    transactionContext.curve = (((cmd->p2 & P2_ED25519) != 0) ? CURVE_Ed25519 : CURVE_256K1);
+    else
+    {
+        // check that p2 is set to either SECP256K1 or ED25519
+        if( ( ((cmd->p2 & P2_SECP256K1) == 0) && ((cmd->p2 & P2_ED25519) == 0) ) ||
+            ( ((cmd->p2 & P2_SECP256K1) != 0) && ((cmd->p2 & P2_ED25519) != 0) )    )
+        {
+            return INVALID_P1_OR_P2;
+        }
 
+        // convert apdu data to bip32 path
+        const buffer_t buffer = { cmd->data, cmd->lc, 0 };
+        transactionContext.pathLength = buffer_get_bip32_path( &buffer, transactionContext.bip32Path );
+        if( 0 == transactionContext.pathLength )
+        {
+            return INVALID_BIP32_PATH_LENGTH;
+        }
+        
+        // set curve
+        transactionContext.curve = (((cmd->p2 & P2_ED25519) != 0) ? CURVE_Ed25519 : CURVE_256K1);
+
+        bip32PathSize = transactionContext.pathLength*4+1;
+    }
 
-    const size_t bip32PathSize = transactionContext.pathLength*4+1;
     buffer_t serializedData = { &cmd->data[bip32PathSize], cmd->lc-bip32PathSize, 0 }; // buffer without the bip32 path
+
+    // Reject what the header already tells before the host uploads the rest of the transaction
+    const ApduResponse_t result = parser_response( check_txn_header(&serializedData, is_mainnet_path(), MAX_RAW_TX - PREFIX_LENGTH) );
+    if( OK != result )
+    {
+        return result;
+    }
+
     return handle_packet_content( &serializedData, !hasMore(cmd->p1) );
 }
 
@@ -174,61 +315,93 @@ ApduResponse_t handle_packet_content( const buffer_t* buffer, const bool lastPac
     // Append received data to stored transaction data
     memcpy( transactionContext.rawTx + transactionContext.rawTxLength, buffer->ptr, buffer->size );
     transactionContext.rawTxLength += buffer->size;
+    transactionContext.rawTxUsed    = transactionContext.rawTxLength;
+    transactionContext.chunkCount++;
+    cx_hash( &transactionContext.rawTxHash.header, 0, buffer->ptr, buffer->size, NULL, 0 );
+    merkle_update( &G_arena.upload.merkle, transactionContext.rawTx, transactionContext.rawTxLength );
 
     if( !lastPacket )
     {
-        // Reply to sender with status OK, so that next packet is sent
         signState = WAITING_FOR_MORE;
-        const int succ = io_send_response(NULL, OK);
+
+        // Reply to sender with the session id and status OK, so that next packet is sent
+        buffer_t sessionId = { uploadSession.id, UPLOAD_SESSION_ID_LENGTH, 0 };
+        const int succ = io_send_response(&sessionId, OK);
         return ( (succ != -1) ? OK : INTERNAL_ERROR );
     }
     else
     {
+        // an aggregate must show the inner transactions its hash commits to
+        if( !merkle_verify(&G_arena.upload.merkle, transactionContext.rawTx) )
+        {
+            return INVALID_SIGNING_DATA;
+        }
+
         // All data received, prepare transaction fields to be presented to user
-        signState = PENDING_REVIEW;
+        signState = previewUpload ? PREVIEW_READY : PENDING_REVIEW;
 
         rawTxData.ptr    = transactionContext.rawTx;
         rawTxData.size   = transactionContext.rawTxLength;
         rawTxData.offset = 0;
 
-        int status = parse_txn_context(&rawTxData, &fields);
+        arena_enter( ARENA_REVIEW );
+        TRACE( TRACE_PARSE_BEGIN, rawTxData.size );
+        const ApduResponse_t result = parser_response( parse_txn_context(&rawTxData, is_mainnet_path(), &G_arena.review.fields) );
+        TRACE( TRACE_PARSE_END, OK == result ? G_arena.review.fields.numFields : 0 );
+        if( OK != result )
+        {
+            return result;
+        }
 
-        switch( status )
+        // only this part of the transaction is signed
+        transactionContext.rawTxLength = G_arena.review.fields.signLength;
+
+        // a flagged request must be the cosignature of a hash
+        if( transactionContext.cosignature && transactionContext.rawTxLength != XYM_TRANSACTION_HASH_LENGTH )
         {
-            case E_TOO_MANY_FIELDS:
-            {
-                // Abort if there are too many fields to show on Ledger device
-                return TOO_MANY_TRANSACTION_FIELDS;
-            }
-            case E_NOT_ENOUGH_DATA:
-            case E_INVALID_DATA:
-            {
-                return INVALID_SIGNING_DATA;
-            }
-            default: // E_SUCCESS
-                break;
+            return INVALID_P1_OR_P2;
         }
 
-        review_transaction(&fields, sign_transaction, reject_transaction);
+        stats_transaction( rawTxData.size, G_arena.review.fields.numFields );
+        if( previewUpload )
+        {
+            // the screens go back to the host instead of the user
+            return start_preview();
+        }
+        review_transaction(&G_arena.review.fields, transactionContext.cosignature, sign_transaction, reject_transaction);
 
         return OK;
     }
 }
 
 int handle_sign( const ApduCommand_t* cmd ) 
+{
+    return handle_upload( cmd, false );
+}
+
+int handle_upload( const ApduCommand_t* cmd, bool preview ) 
 {
     ApduResponse_t result;
 
+    // a change of instruction resets the context, an upload is only ever seen by one of them
+    previewUpload = preview;
+
     switch( signState )
     {
         case IDLE:
         {
-            result = handle_first_packet( cmd );
+            result = isResume(cmd->p1) ? INVALID_SIGNING_PACKET_ORDER : handle_first_packet( cmd );
             break;
         }
         case WAITING_FOR_MORE:
         {
-            result = handle_subsequent_packet( cmd );
+            result = isResume(cmd->p1) ? handle_resume_query( cmd ) : handle_subsequent_packet( cmd );
+            break;
+        }
+        case UPLOAD_SUSPENDED:
+        {
+            // after a transport reset the host either resumes the upload or starts a new one
+            result = isResume(cmd->p1) ? handle_resume_query( cmd ) : handle_first_packet( cmd );
             break;
         }
         default:
@@ -22,8 +22,6 @@
 #include "xym/parse/xym_parse.h"
 #include "types.h"
 
-extern fields_array_t fields;
-
 
 
 /**
@@ -39,4 +37,43 @@ extern fields_array_t fields;
 int handle_sign( const ApduCommand_t* cmd );
 
 
+/**
+ * Same upload as 'handle_sign()'. With 'preview' set, the parsed transaction
+ * is handed to 'start_preview()' instead of being reviewed.
+ *
+ * @param[in] cmd
+ *   Structured APDU command (CLA, INS, P1, P2, Lc, Command data).
+ *
+ * @param[in] preview
+ *   true for PREVIEW_TX, false for SIGN_TX.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handle_upload( const ApduCommand_t* cmd, bool preview );
+
+
+/**
+ * Clears the upload session (id and resume timeout).
+ *
+ */
+void reset_upload_session();
+
+
+/**
+ * Keeps the upload session alive for UPLOAD_RESUME_TIMEOUT_TICKS ticker
+ * events, see 'tick_upload_session()'.
+ *
+ */
+void suspend_upload_session();
+
+
+/**
+ * Must be called on every ticker event. Resets the transaction context
+ * once a suspended upload has not been resumed in time.
+ *
+ */
+void tick_upload_session();
+
+
 #endif //LEDGER_APP_XYM_SIGNTRANSACTION_H
@@ -0,0 +1,53 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "arena.h"
+
+arena_t G_arena;
+static arena_phase_e arenaPhase;
+
+
+void arena_enter( arena_phase_e phase )
+{
+    switch( arenaPhase )
+    {
+        case ARENA_UPLOAD:
+        {
+            explicit_bzero( &G_arena.upload, sizeof(G_arena.upload) );
+            break;
+        }
+        case ARENA_REVIEW:
+        {
+            explicit_bzero( &G_arena.review, sizeof(G_arena.review) );
+            break;
+        }
+        case ARENA_PUBLIC_KEY:
+        {
+            explicit_bzero( &G_arena.publicKey, sizeof(G_arena.publicKey) );
+            break;
+        }
+        case ARENA_CONTACT:
+        {
+            explicit_bzero( &G_arena.contact, sizeof(G_arena.contact) );
+            break;
+        }
+        default: // ARENA_IDLE
+            break;
+    }
+
+    arenaPhase = phase;
+}
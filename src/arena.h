@@ -0,0 +1,78 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_ARENA_H
+#define LEDGER_APP_XYM_ARENA_H
+
+#include <stdint.h>
+#include "limitations.h"
+#include "xym/xym_helpers.h"
+#include "xym/parse/xym_parse.h"
+#include "merkle.h"
+
+/**
+ * Buffers that are never live at the same time share the same RAM.
+ * 
+ * The raw transaction ('transactionContext.rawTx') is not part of it:
+ * it is needed from the first packet until the signature. The signature
+ * itself is written straight into the APDU buffer.
+ */
+
+typedef enum {
+    ARENA_IDLE,         ///< nothing is live, the arena is all zero
+    ARENA_UPLOAD,       ///< state kept while the transaction is received
+    ARENA_REVIEW,       ///< transaction fields and the field being displayed
+    ARENA_PUBLIC_KEY,   ///< public key and address waiting for the user
+    ARENA_CONTACT,      ///< address book change waiting for the user
+} arena_phase_e;
+
+typedef union {
+    struct {
+        merkle_t       merkle;                       ///< transactions hash of an aggregate, checked before parsing
+    } upload;
+
+    struct {
+        fields_array_t fields;                       ///< extracted from rawTx, point into it
+        char           fieldName[MAX_FIELDNAME_LEN]; ///< title of the displayed field
+        char           fieldValue[MAX_FIELD_LEN];    ///< value of the displayed field
+    } review;
+
+    struct {
+        uint8_t        key[XYM_PUBLIC_KEY_LENGTH];
+        char           address[XYM_PRETTY_ADDRESS_LENGTH+1];
+    } publicKey;
+
+    struct {
+        bool           remove;                              ///< true to remove the address, add or rename it otherwise
+        uint8_t        address[XYM_ADDRESS_LENGTH];
+        char           label[MAX_CONTACT_LABEL_LEN+1];
+        char           prettyAddress[XYM_PRETTY_ADDRESS_LENGTH+1];
+        char           action[sizeof("Rename")];            ///< "Add", "Rename" or "Remove"
+    } contact;
+} arena_t;
+
+extern arena_t G_arena;
+
+
+/**
+ * Wipes what the current phase has written to the arena and starts
+ * 'phase'. Every phase starts on a zeroed arena.
+ * 
+ */
+void arena_enter( arena_phase_e phase );
+
+#endif //LEDGER_APP_XYM_ARENA_H
@@ -19,6 +19,9 @@
 ********************************************************************************/
 
 #include "base32.h"
+#ifdef HAVE_CODEC_KERNELS
+#include "codec.h"
+#endif
 
 int base32_encode(const uint8_t *data, int length, char *result, int bufSize) {
     int count = 0;
@@ -27,6 +30,16 @@ int base32_encode(const uint8_t *data, int length, char *result, int bufSize) {
         return -1;
     }
 
+#ifdef HAVE_CODEC_KERNELS
+    // Host library: whole groups of 5 bytes go to the vector kernel when the
+    // result fits, the tail is encoded (and padded) below
+    int groups = length / 5;
+    if (groups > 0 && bufSize > (length + 4) / 5 * 8 && codec_kernel() != CODEC_SCALAR) {
+        codec_base32(data, groups, result);
+        return groups * 8 + base32_encode(data + groups * 5, length - groups * 5, result + groups * 8, bufSize - groups * 8);
+    }
+#endif
+
     if (length > 0) {
         unsigned int buffer = data[0];
         int next = 1;
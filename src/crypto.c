@@ -17,8 +17,10 @@
 #include "crypto.h"
 #include "xym_helpers.h"
 #include "limitations.h"
+#include "trace.h"
 
 #include <string.h>
+#include "base32.h"
 
 
 void crypto_derive_private_key( const uint32_t*              bip32_path,
@@ -28,6 +30,7 @@ void crypto_derive_private_key( const uint32_t*              bip32_path,
 {
     uint8_t raw_private_key[XYM_PRIVATE_KEY_LENGTH] = {0};
 
+    TRACE( TRACE_DERIVE_BEGIN, bip32_path_len );
     BEGIN_TRY 
     {
         TRY 
@@ -71,4 +74,44 @@ void crypto_derive_private_key( const uint32_t*              bip32_path,
         }
     }
     END_TRY;
+    TRACE( TRACE_DERIVE_END, 0 );
+}
+
+static void sha_calculation(uint8_t *in, uint8_t inlen, uint8_t *out, uint8_t outlen) {
+    cx_sha3_t hash;
+    cx_sha3_init(&hash, 256);
+    cx_hash(&hash.header, CX_LAST, in, inlen, out, outlen);
+}
+
+static void ripemd(uint8_t *in, uint8_t inlen, uint8_t *out, uint8_t outlen) {
+    cx_ripemd160_t hash;
+    cx_ripemd160_init(&hash);
+    cx_hash(&hash.header, CX_LAST, in, inlen, out, outlen);
+}
+
+void xym_public_key_and_address( cx_ecfp_public_key_t *inPublicKey, uint8_t inNetworkId, uint8_t *outPublicKey, char *outAddress, uint8_t outLen ) 
+{
+     // TODO: use defines instead hardcoded numbers
+
+    uint8_t buffer1[32];
+    uint8_t buffer2[20];
+    uint8_t rawAddress[32];
+
+    for (uint8_t i=0; i<32; i++) {
+        outPublicKey[i] = inPublicKey->W[64 - i];
+    }
+    if ((inPublicKey->W[32] & 1) != 0) {
+        outPublicKey[31] |= 0x80;
+    }
+    sha_calculation(outPublicKey, 32, buffer1, sizeof(buffer1));
+    ripemd(buffer1, 32, buffer2, sizeof(buffer2));
+    //step1: add network prefix char
+    rawAddress[0] = inNetworkId;
+    //step2: add ripemd160 hash
+    memcpy(rawAddress + 1, buffer2, sizeof(buffer2));
+    sha_calculation(rawAddress, 21, buffer1, sizeof(buffer1));
+    //step3: add checksum
+    memcpy(rawAddress + 21, buffer1, 3);
+    rawAddress[24] = 0;
+    base32_encode((const uint8_t *)rawAddress, 24, (char *) outAddress, outLen);
 }
@@ -3,6 +3,7 @@
 
 #include <stdint.h>  
 #include "os.h"
+#include "cx.h"
 
 
 /**
@@ -39,4 +40,16 @@ typedef enum
 void crypto_derive_private_key( const uint32_t*        bip32_path,
                                 const uint8_t          bip32_path_len,
                                 const CurveType_t      curve_type,
-                                cx_ecfp_private_key_t* private_key    );
\ No newline at end of file
+                                cx_ecfp_private_key_t* private_key    );
+
+
+/**
+ * Public key in Symbol's compressed form and its address.
+ *
+ * @param[in]  inPublicKey   the public key derived by the SDK
+ * @param[in]  inNetworkId   network type byte of the address
+ * @param[out] outPublicKey  XYM_PUBLIC_KEY_LENGTH bytes
+ * @param[out] outAddress    base32 address
+ * @param[in]  outLen        size of 'outAddress'
+ */
+void xym_public_key_and_address( cx_ecfp_public_key_t *inPublicKey, uint8_t inNetworkId, uint8_t *outPublicKey, char *outAddress, uint8_t outLen );
@@ -3,6 +3,8 @@
 #include <stdbool.h>
 #include "types.h" //TODO: use constants.h instead
 #include <os_io_seproxyhal.h>
+#include "trace.h"
+#include "stats.h"
 
 /**
  * Enumeration for the status of IO.
@@ -44,22 +46,18 @@ bool buffer_copy(const buffer_t *buffer, uint8_t *out, size_t out_len)
     return true;
 }
 
-/**
- * Write 16-bit unsigned integer value as Big Endian.
- *
- * @param[out] ptr
- *   Pointer to output byte buffer.
- * @param[in]  offset
- *   Offset in the output byte buffer.
- * @param[in]  value
- *   16-bit unsigned integer to write in output byte buffer as Big Endian.
- *
- */
 void write_u16_be(uint8_t *ptr, size_t offset, uint16_t value) {
     ptr[offset + 0] = (uint8_t)(value >> 8);
     ptr[offset + 1] = (uint8_t)(value >> 0);
 }
 
+void write_u32_be(uint8_t *ptr, size_t offset, uint32_t value) {
+    ptr[offset + 0] = (uint8_t)(value >> 24);
+    ptr[offset + 1] = (uint8_t)(value >> 16);
+    ptr[offset + 2] = (uint8_t)(value >> 8);
+    ptr[offset + 3] = (uint8_t)(value >> 0);
+}
+
 
 void io_init()
 {
@@ -125,6 +123,8 @@ int io_send_response(const buffer_t *rdata, uint16_t sw)
 
     write_u16_be(G_io_apdu_buffer, G_output_len, sw);
     G_output_len += 2;
+    TRACE(TRACE_RESPONSE_SENT, sw);
+    stats_response(sw);
 
     int ret;
     switch (G_io_state) 
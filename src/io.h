@@ -89,3 +89,31 @@ int io_send_response(const buffer_t *rdata, uint16_t sw);
  */
 int io_send_error(uint16_t sw);
 
+
+/**
+ * Write 16-bit unsigned integer value as Big Endian.
+ *
+ * @param[out] ptr
+ *   Pointer to output byte buffer.
+ * @param[in]  offset
+ *   Offset in the output byte buffer.
+ * @param[in]  value
+ *   16-bit unsigned integer to write in output byte buffer as Big Endian.
+ *
+ */
+void write_u16_be(uint8_t *ptr, size_t offset, uint16_t value);
+
+
+/**
+ * Write 32-bit unsigned integer value as Big Endian.
+ *
+ * @param[out] ptr
+ *   Pointer to output byte buffer.
+ * @param[in]  offset
+ *   Offset in the output byte buffer.
+ * @param[in]  value
+ *   32-bit unsigned integer to write in output byte buffer as Big Endian.
+ *
+ */
+void write_u32_be(uint8_t *ptr, size_t offset, uint32_t value);
+
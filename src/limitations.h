@@ -18,8 +18,10 @@
 #ifndef LEDGER_APP_XYM_LIMITATIONS_H
 #define LEDGER_APP_XYM_LIMITATIONS_H
 
-// Needed to resolve target macros
+// Needed to resolve target macros, host builds may define the target themselves
+#if !defined(TARGET_NANOX) && !defined(TARGET_NANOS2) && !defined(TARGET_NANOS)
 #include <bolos_target.h>
+#endif
 
 // Hardware independent limits
 #define MAX_BIP32_PATH 5
@@ -28,6 +30,10 @@
 #define MAX_ARRAY_LEN 8
 #define MAX_PATH_COUNT 6
 #define MAX_STEP_COUNT 8
+#define MAX_ACCOUNT_SLOTS 4
+#define MAX_SUMMARY_MOSAICS 4
+#define MAX_SUMMARY_RECIPIENTS 8
+#define MAX_CONTACT_LABEL_LEN 20
 
 // Hardware dependent limits
 //   Ledger Nano X has 30K RAM
@@ -35,17 +41,27 @@
 #if defined(TARGET_NANOX) || defined(TARGET_NANOS2)
 
 #define MAX_FIELD_COUNT 60
-#define MAX_FIELD_LEN 1024
+#define MAX_FIELD_LEN 256
 #define MAX_RAW_TX 10000
+#define MAX_TRACE_RECORDS 128
+#define MAX_ADDRESS_BOOK_ENTRIES 256
 #define DISPLAY_SEGMENTED_ADDR false
 
 #elif defined(TARGET_NANOS)
 
+// Not raised with the phase arena: the RAM it saved went to the upload hash,
+// the account slots, the statistics and the aggregate summary. Not checked
+// against an SDK build, keep these as they are until it is.
 #define MAX_FIELD_COUNT 24
 #define MAX_FIELD_LEN 128
 #define MAX_RAW_TX 800
+#define MAX_TRACE_RECORDS 32
+#define MAX_ADDRESS_BOOK_ENTRIES 32
 #define DISPLAY_SEGMENTED_ADDR true
 
 #endif
 
+// Every inner transaction is shown with its type and at least one more field
+#define MAX_INNER_TX_COUNT (MAX_FIELD_COUNT / 2)
+
 #endif //LEDGER_APP_XYM_LIMITATIONS_H
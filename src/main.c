@@ -21,11 +21,15 @@
 #include <ux.h>
 #include "apdu/entry.h"
 #include "apdu/global.h"
+#include "apdu/messages/sign_transaction.h"
+#include "apdu/messages/select_account.h"
 #include "ui/main/idle_menu.h"
 #include "ui/address/address_ui.h"
 #include "types.h"
 #include "io.h"
 #include "parser.h"
+#include "stats.h"
+#include "address_book.h"
 
 // IO_SEPROXYHAL_BUFFER_SIZE_B define in Makefile
 unsigned char G_io_seproxyhal_spi_buffer[IO_SEPROXYHAL_BUFFER_SIZE_B];
@@ -122,6 +126,8 @@ unsigned char io_event(unsigned char channel)
 
     case SEPROXYHAL_TAG_TICKER_EVENT:
         UX_TICKER_EVENT(G_io_seproxyhal_spi_buffer, {
+            tick_upload_session();
+            stats_ticker();
             if (UX_ALLOWED) {
                 // redisplay screen
                 UX_REDISPLAY();
@@ -161,8 +167,13 @@ __attribute__((section(".boot"))) int main(void) {
     // ensure exception will work as planned
     os_boot();
 
+    // an address book update cut by a power loss is finished first
+    address_book_recover();
+
     for (;;) {
-        reset_transaction_context();
+        // an upload interrupted by the transport reset can be resumed, selected accounts cannot
+        suspend_transaction_context();
+        reset_account_slots();
 
         UX_INIT()
         BEGIN_TRY {
@@ -0,0 +1,188 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "merkle.h"
+#include <string.h>
+#include "limitations.h"
+
+// offsets in the raw transaction: the hash in front of it, then the common header and fee
+#define TYPE_OFFSET              (XYM_TRANSACTION_HASH_LENGTH + 2)
+#define TRANSACTIONS_HASH_OFFSET (XYM_TRANSACTION_HASH_LENGTH + 4 + 16)
+#define PAYLOAD_SIZE_OFFSET      (TRANSACTIONS_HASH_OFFSET + XYM_TRANSACTION_HASH_LENGTH)
+#define PAYLOAD_OFFSET           (PAYLOAD_SIZE_OFFSET + 8)
+
+#define INNER_HEADER_SIZE        (4 + 4 + XYM_PUBLIC_KEY_LENGTH + 4 + 4)
+#define INNER_ALIGNMENT          8
+
+static uint32_t read_u32_le( const uint8_t* data )
+{
+    return (uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+// out = SHA3-256(left | right), 'out' may be either input
+static void hash_pair( cx_sha3_t* hash, const uint8_t* left, const uint8_t* right, uint8_t* out )
+{
+    cx_sha3_init( hash, 256 );
+    cx_hash( &hash->header, 0, left,  XYM_TRANSACTION_HASH_LENGTH, NULL, 0 );
+    cx_hash( &hash->header, 0, right, XYM_TRANSACTION_HASH_LENGTH, NULL, 0 );
+    cx_hash( &hash->header, CX_LAST, NULL, 0, out, XYM_TRANSACTION_HASH_LENGTH );
+}
+
+// merges 'leaf' with the complete subtrees on its left, like a binary counter
+static void push_leaf( merkle_t* merkle, uint8_t* leaf )
+{
+    uint8_t level = 0;
+    while( (merkle->pending & (1u << level)) != 0 )
+    {
+        hash_pair( &merkle->hash, merkle->level[level], leaf, leaf );
+        merkle->pending &= ~(1u << level);
+        level++;
+    }
+    memcpy( merkle->level[level], leaf, XYM_TRANSACTION_HASH_LENGTH );
+    merkle->pending |= 1u << level;
+    merkle->leafCount++;
+}
+
+static void start_payload( merkle_t* merkle, const uint8_t* rawTx )
+{
+    const uint16_t type = (uint16_t) (rawTx[TYPE_OFFSET] | (rawTx[TYPE_OFFSET + 1] << 8));
+    if( type != XYM_TXN_AGGREGATE_COMPLETE && type != XYM_TXN_AGGREGATE_BONDED )
+    {
+        merkle->state = MERKLE_NONE;
+        return;
+    }
+
+    const uint32_t payloadSize = read_u32_le( &rawTx[PAYLOAD_SIZE_OFFSET] );
+    if( payloadSize > MAX_RAW_TX )
+    {
+        merkle->state = MERKLE_FAILED;
+        return;
+    }
+
+    merkle->state  = MERKLE_LEAVES;
+    merkle->offset = PAYLOAD_OFFSET;
+    merkle->end    = PAYLOAD_OFFSET + payloadSize;
+}
+
+void merkle_update( merkle_t* merkle, const uint8_t* rawTx, uint32_t length )
+{
+    if( merkle->state == MERKLE_HEADER && length >= PAYLOAD_OFFSET )
+    {
+        start_payload( merkle, rawTx );
+    }
+
+    while( merkle->state == MERKLE_LEAVES )
+    {
+        if( merkle->leafEnd == 0 )
+        {
+            if( merkle->offset >= merkle->end )
+            {
+                merkle->state = MERKLE_DONE;
+                break;
+            }
+
+            // the size of the next inner transaction may still be in the next packet
+            if( merkle->offset + 4 > length )
+            {
+                break;
+            }
+
+            const uint32_t size = read_u32_le( &rawTx[merkle->offset] );
+            if( size < INNER_HEADER_SIZE || size > merkle->end - merkle->offset || merkle->leafCount == (1u << MERKLE_MAX_DEPTH) - 1 )
+            {
+                merkle->state = MERKLE_FAILED;
+                break;
+            }
+
+            merkle->leafEnd = merkle->offset + size;
+            cx_sha3_init( &merkle->hash, 256 );
+        }
+
+        if( merkle->offset >= length )
+        {
+            break;
+        }
+
+        const uint32_t stop = (length < merkle->leafEnd) ? length : merkle->leafEnd;
+        cx_hash( &merkle->hash.header, 0, &rawTx[merkle->offset], stop - merkle->offset, NULL, 0 );
+        merkle->offset = stop;
+
+        if( merkle->offset == merkle->leafEnd )
+        {
+            uint8_t leaf[XYM_TRANSACTION_HASH_LENGTH];
+            cx_hash( &merkle->hash.header, CX_LAST, NULL, 0, leaf, sizeof(leaf) );
+            push_leaf( merkle, leaf );
+
+            // the padding is not hashed, the next inner transaction is aligned in the payload
+            merkle->offset += (INNER_ALIGNMENT - (merkle->offset - PAYLOAD_OFFSET) % INNER_ALIGNMENT) % INNER_ALIGNMENT;
+            merkle->leafEnd = 0;
+        }
+    }
+}
+
+bool merkle_verify( merkle_t* merkle, const uint8_t* rawTx )
+{
+    switch( merkle->state )
+    {
+        case MERKLE_HEADER: // too short to be an aggregate, the parser rejects it
+        case MERKLE_NONE:
+        {
+            return true;
+        }
+        case MERKLE_DONE:
+        {
+            break;
+        }
+        default: // MERKLE_LEAVES, MERKLE_FAILED
+        {
+            return false;
+        }
+    }
+
+    // pair the pending subtrees from the lowest level, a subtree alone on its level is paired with itself
+    uint8_t root[XYM_TRANSACTION_HASH_LENGTH] = { 0 };
+    bool carry = false;
+    for( uint8_t level = 0; level < MERKLE_MAX_DEPTH; level++ )
+    {
+        const bool pending = (merkle->pending & (1u << level)) != 0;
+        const bool above   = (merkle->pending >> (level + 1)) != 0;
+        if( pending && carry )
+        {
+            hash_pair( &merkle->hash, merkle->level[level], root, root );
+        }
+        else if( pending )
+        {
+            if( !above )
+            {
+                memcpy( root, merkle->level[level], sizeof(root) );
+                break;
+            }
+            hash_pair( &merkle->hash, merkle->level[level], merkle->level[level], root );
+            carry = true;
+        }
+        else if( carry )
+        {
+            if( !above )
+            {
+                break;
+            }
+            hash_pair( &merkle->hash, root, root, root );
+        }
+    }
+
+    return memcmp( root, &rawTx[TRANSACTIONS_HASH_OFFSET], sizeof(root) ) == 0;
+}
@@ -0,0 +1,73 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_MERKLE_H
+#define LEDGER_APP_XYM_MERKLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <cx.h>
+#include "xym/xym_helpers.h"
+
+/**
+ * Checks the transactions hash of an aggregate while it is uploaded.
+ *
+ * The hash is the Merkle root of the SHA3-256 of every inner transaction
+ * (without its padding), a level with an odd number of hashes pairing its
+ * last one with itself. Each inner transaction is hashed as its bytes come
+ * in and only one pending subtree per level is kept, so that the root is
+ * known as soon as the last packet is received.
+ */
+
+#define MERKLE_MAX_DEPTH 8   ///< up to 2^8 - 1 inner transactions, more than fit in MAX_RAW_TX
+
+typedef enum {
+    MERKLE_HEADER,      ///< waiting for the aggregate header
+    MERKLE_NONE,        ///< not an aggregate, nothing to check
+    MERKLE_LEAVES,      ///< hashing the inner transactions
+    MERKLE_DONE,        ///< the whole payload has been hashed
+    MERKLE_FAILED,      ///< the inner transaction sizes do not fit the payload
+} merkle_state_e;
+
+typedef struct {
+    merkle_state_e state;
+    uint32_t  offset;                                               ///< next byte of the raw transaction to hash
+    uint32_t  end;                                                  ///< end of the aggregate payload
+    uint32_t  leafEnd;                                              ///< end of the inner transaction being hashed, 0 between them
+    uint16_t  leafCount;                                            ///< inner transactions hashed so far
+    uint8_t   pending;                                              ///< bit i is set when level[i] holds a subtree
+    cx_sha3_t hash;
+    uint8_t   level[MERKLE_MAX_DEPTH][XYM_TRANSACTION_HASH_LENGTH];
+} merkle_t;
+
+
+/**
+ * Hashes the bytes of the raw transaction from where the previous call
+ * stopped up to 'length'. 'merkle' starts zeroed, the bytes before 'length'
+ * must not change between calls.
+ */
+void merkle_update( merkle_t* merkle, const uint8_t* rawTx, uint32_t length );
+
+
+/**
+ * Once the whole transaction has been passed to 'merkle_update()', tells
+ * whether the transactions hash of an aggregate matches its inner
+ * transactions. Always true for other transactions.
+ */
+bool merkle_verify( merkle_t* merkle, const uint8_t* rawTx );
+
+#endif //LEDGER_APP_XYM_MERKLE_H
@@ -0,0 +1,88 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "stats.h"
+#include "types.h"
+
+app_stats_t G_stats;
+
+static uint32_t statsTicks;
+
+// the last entry of both tables is the bucket for everything else
+const uint8_t STATS_INSTRUCTIONS[STATS_INS_COUNT] = {
+    GET_PUBLIC_KEY, SIGN_TX, GET_VERSION, SELECT_ACCOUNT, GET_STATS, PREVIEW_TX, EDIT_ADDRESS_BOOK, 0x00
+};
+
+const uint16_t STATS_RESPONSES[STATS_RESPONSE_COUNT] = {
+    NO_APDU_RECEIVED, UNKNOWN_INSTRUCTION_CLASS, UNKNOWN_INSTRUCTION, WRONG_APDU_DATA_LENGTH,
+    INVALID_PKG_KEY_LENGTH, INVALID_BIP32_PATH_LENGTH, INVALID_P1_OR_P2, WRONG_RESPONSE_LENGTH,
+    ADDRESS_REJECTED, TRANSACTION_REJECTED, INVALID_SIGNING_PACKET_ORDER, SIGNING_DATA_TOO_LARGE,
+    TOO_MANY_TRANSACTION_FIELDS, INVALID_TRANSACTION_DATA, INVALID_INTERNAL_SIGNING_STATE,
+    INTERNAL_ERROR, INVALID_CONTACT, ADDRESS_BOOK_FULL, 0x0000
+};
+
+
+void stats_ticker( void )
+{
+    statsTicks++;
+}
+
+// the native build links its own microsecond clock
+__attribute__((weak)) uint32_t stats_clock( void )
+{
+    return statsTicks;
+}
+
+void stats_apdu( uint8_t ins )
+{
+    uint8_t i = 0;
+    while( i < STATS_INS_COUNT - 1 && STATS_INSTRUCTIONS[i] != ins )
+    {
+        i++;
+    }
+
+    G_stats.insCount[i]++;
+}
+
+void stats_response( uint16_t sw )
+{
+    if( sw == OK )
+    {
+        return;
+    }
+
+    uint8_t i = 0;
+    while( i < STATS_RESPONSE_COUNT - 1 && STATS_RESPONSES[i] != sw )
+    {
+        i++;
+    }
+
+    G_stats.errorCount[i]++;
+}
+
+void stats_transaction( uint32_t rawTxLength, uint8_t fieldCount )
+{
+    if( rawTxLength > G_stats.maxRawTxLength )
+    {
+        G_stats.maxRawTxLength = rawTxLength;
+    }
+
+    if( fieldCount > G_stats.maxFieldCount )
+    {
+        G_stats.maxFieldCount = fieldCount;
+    }
+}
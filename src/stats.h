@@ -0,0 +1,56 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_STATS_H
+#define LEDGER_APP_XYM_STATS_H
+
+#include <stdint.h>
+
+/**
+ * Counters about the traffic seen since the app was started, read with
+ * GET_STATS. They only live in RAM.
+ */
+
+// stats_clock() counts ticker events unless the build provides a finer clock
+#ifndef STATS_CLOCK_PERIOD_US
+#define STATS_CLOCK_PERIOD_US 100000
+#endif
+
+#define STATS_INS_COUNT 8        ///< known instructions and one bucket for the others
+#define STATS_RESPONSE_COUNT 19  ///< error status words and one bucket for the others
+
+typedef struct {
+    uint32_t insCount[STATS_INS_COUNT];           ///< APDUs received, see STATS_INSTRUCTIONS
+    uint32_t errorCount[STATS_RESPONSE_COUNT];    ///< error responses sent, see STATS_RESPONSES
+    uint32_t maxRawTxLength;                      ///< longest transaction parsed
+    uint8_t  maxFieldCount;                       ///< most fields extracted from a transaction
+    uint32_t signatureCount;
+} app_stats_t;
+
+extern app_stats_t G_stats;
+
+extern const uint8_t  STATS_INSTRUCTIONS[STATS_INS_COUNT];
+extern const uint16_t STATS_RESPONSES[STATS_RESPONSE_COUNT];
+
+void     stats_ticker( void );
+uint32_t stats_clock( void );
+
+void     stats_apdu( uint8_t ins );
+void     stats_response( uint16_t sw );
+void     stats_transaction( uint32_t rawTxLength, uint8_t fieldCount );
+
+#endif //LEDGER_APP_XYM_STATS_H
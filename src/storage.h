@@ -0,0 +1,44 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_STORAGE_H
+#define LEDGER_APP_XYM_STORAGE_H
+
+#include <os.h>
+#include "address_book.h"
+
+/**
+ * Data kept in flash across app restarts. It is zero when the app is
+ * installed and only ever written with nvm_write(), read it through
+ * N_storage.
+ */
+
+// the native SDK stand-in keeps it in RAM
+#ifndef NVM_CONST
+#define NVM_CONST const
+#endif
+
+typedef struct {
+    address_book_t addressBook;
+    uint8_t        fastCosign;    ///< 1 to approve the cosignature the host asks for on its hash alone
+} internal_storage_t;
+
+extern NVM_CONST internal_storage_t N_storage_real;
+
+#define N_storage (*(volatile internal_storage_t*) PIC(&N_storage_real))
+
+#endif //LEDGER_APP_XYM_STORAGE_H
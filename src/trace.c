@@ -0,0 +1,77 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifdef HAVE_TRACE
+
+#include "trace.h"
+#include <stddef.h>
+#include "limitations.h"
+#include "stats.h"
+
+static trace_record_t traceRecords[ MAX_TRACE_RECORDS ];
+static uint32_t       traceTotal;   ///< records written since the last clear
+static bool           tracePaused;
+
+
+void trace_event( uint8_t event, uint16_t arg )
+{
+    if( tracePaused )
+    {
+        return;
+    }
+
+    trace_record_t* record = &traceRecords[ traceTotal % MAX_TRACE_RECORDS ];
+
+    record->tick     = stats_clock();
+    record->arg      = arg;
+    record->event    = event;
+    record->sequence = (uint8_t) traceTotal;
+    traceTotal++;
+}
+
+void trace_pause( bool paused )
+{
+    tracePaused = paused;
+}
+
+uint32_t trace_total( void )
+{
+    return traceTotal;
+}
+
+uint16_t trace_size( void )
+{
+    return traceTotal < MAX_TRACE_RECORDS ? (uint16_t) traceTotal : MAX_TRACE_RECORDS;
+}
+
+const trace_record_t* trace_record( uint16_t index )
+{
+    if( index >= trace_size() )
+    {
+        return NULL;
+    }
+
+    // index 0 is the oldest record still in the ring
+    return &traceRecords[ (traceTotal - trace_size() + index) % MAX_TRACE_RECORDS ];
+}
+
+void trace_clear( void )
+{
+    traceTotal = 0;
+}
+
+#endif // HAVE_TRACE
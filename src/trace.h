@@ -0,0 +1,69 @@
+/*******************************************************************************
+*    XYM Wallet
+*    (c) 2020 Ledger
+*    (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_TRACE_H
+#define LEDGER_APP_XYM_TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Binary trace of the hot paths, compiled in with HAVE_TRACE ('make TRACE=1').
+ *
+ * Probes append fixed size records to a RAM ring buffer, the oldest records
+ * are overwritten. The GET_TRACE instruction reads them back and
+ * 'trace_decode.py' turns them into a latency breakdown.
+ */
+
+typedef enum {
+    TRACE_APDU_RECEIVED = 0x01,   ///< arg: INS
+    TRACE_RESPONSE_SENT = 0x02,   ///< arg: status word
+    TRACE_PARSE_BEGIN   = 0x10,   ///< arg: raw transaction length
+    TRACE_PARSE_END     = 0x11,   ///< arg: number of fields, 0 on error
+    TRACE_FORMAT_BEGIN  = 0x20,   ///< arg: field id
+    TRACE_FORMAT_END    = 0x21,   ///< arg: field id
+    TRACE_DERIVE_BEGIN  = 0x30,   ///< arg: BIP32 path length
+    TRACE_DERIVE_END    = 0x31,
+    TRACE_SIGN_BEGIN    = 0x40,   ///< arg: length of the signed data
+    TRACE_SIGN_END      = 0x41,   ///< arg: signature length
+} trace_event_e;
+
+typedef struct {
+    uint32_t tick;       ///< stats_clock() when the event happened, on the device it only moves between APDUs
+    uint16_t arg;        ///< depends on the event
+    uint8_t  event;      ///< one of trace_event_e
+    uint8_t  sequence;   ///< low byte of the record number, shows overwritten records
+} trace_record_t;
+
+#ifdef HAVE_TRACE
+
+void                  trace_event( uint8_t event, uint16_t arg );
+void                  trace_pause( bool paused );
+uint32_t              trace_total( void );
+uint16_t              trace_size( void );
+const trace_record_t* trace_record( uint16_t index );
+void                  trace_clear( void );
+
+#define TRACE(event, arg) trace_event( (event), (uint16_t) (arg) )
+
+#else
+
+#define TRACE(event, arg)
+
+#endif // HAVE_TRACE
+
+#endif //LEDGER_APP_XYM_TRACE_H
@@ -35,9 +35,9 @@ void on_approval_menu_result(unsigned int result) {
     }
 }
 
-void review_transaction(fields_array_t* fields, action_t onApprove, action_t onReject) {
+void review_transaction(fields_array_t* fields, bool cosignature, action_t onApprove, action_t onReject) {
     approval_action = onApprove;
     rejection_action = onReject;
 
-    display_review_menu(fields, on_approval_menu_result);
+    display_review_menu(fields, cosignature, on_approval_menu_result);
 }
@@ -23,6 +23,8 @@ typedef enum
     INVALID_TRANSACTION_DATA       = 0x6702,
     INVALID_INTERNAL_SIGNING_STATE = 0x6703,
     INVALID_SIGNING_DATA           = 0x6A82,
+    INVALID_CONTACT                = 0x6A85,
+    ADDRESS_BOOK_FULL              = 0x6A84,
 
     INTERNAL_ERROR                 = 0x6A83
 } ApduResponse_t;
@@ -33,9 +35,14 @@ typedef enum
  */
 typedef enum 
 {
-    GET_PUBLIC_KEY = 0x02,  /// public key of corresponding BIP32 path
-    SIGN_TX        = 0x04,  /// sign transaction with BIP32 path
-    GET_VERSION    = 0x06,  /// version of the application
+    GET_PUBLIC_KEY    = 0x02,  /// public key of corresponding BIP32 path
+    SIGN_TX           = 0x04,  /// sign transaction with BIP32 path
+    GET_VERSION       = 0x06,  /// version of the application
+    SELECT_ACCOUNT    = 0x08,  /// pin a BIP32 path to an account slot for SIGN_TX
+    GET_TRACE         = 0x0A,  /// dump the trace ring buffer, HAVE_TRACE builds only
+    GET_STATS         = 0x0C,  /// counters about the traffic since the app started
+    PREVIEW_TX        = 0x0E,  /// upload a transaction like SIGN_TX and read back its screens, nothing is signed
+    EDIT_ADDRESS_BOOK = 0x10,  /// add, rename or remove a labelled address, confirmed by the user
 } ApduInstruction_t;
 
 
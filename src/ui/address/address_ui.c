@@ -22,8 +22,7 @@
 #include "ui/main/idle_menu.h"
 #include "xym/xym_helpers.h"
 #include "glyphs.h"
-
-extern char fieldValue[MAX_FIELD_LEN];
+#include "arena.h"
 
 action_t approval_action;
 action_t rejection_action;
@@ -42,7 +41,7 @@ UX_STEP_NOCB(
         bnnn_paging,
         {
             "Address",
-            fieldValue,
+            G_arena.publicKey.address,
         });
 
 UX_STEP_VALID(
@@ -74,7 +73,55 @@ void display_address_confirmation_ui(char* address, action_t onApprove, action_t
     approval_action = onApprove;
     rejection_action = onReject;
 
-    explicit_bzero(fieldValue, MAX_FIELD_LEN);
-    strncpy(fieldValue, address, XYM_PRETTY_ADDRESS_LENGTH);
+    explicit_bzero(G_arena.publicKey.address, sizeof(G_arena.publicKey.address));
+    strncpy(G_arena.publicKey.address, address, XYM_PRETTY_ADDRESS_LENGTH);
     ux_flow_init(0, ux_display_address_flow, NULL);
 }
+
+UX_STEP_NOCB(
+        ux_display_contact_flow_1_step,
+        pnn,
+        {
+            &C_icon_eye,
+            G_arena.contact.action,
+            "contact",
+        });
+
+UX_STEP_NOCB(
+        ux_display_contact_flow_2_step,
+        bnnn_paging,
+        {
+            "Label",
+            G_arena.contact.label,
+        });
+
+UX_STEP_NOCB(
+        ux_display_contact_flow_3_step,
+        bnnn_paging,
+        {
+            "Address",
+            G_arena.contact.prettyAddress,
+        });
+
+UX_FLOW(ux_display_contact_flow,
+       &ux_display_contact_flow_1_step,
+       &ux_display_contact_flow_2_step,
+       &ux_display_contact_flow_3_step,
+       &ux_display_address_flow_3_step,
+       &ux_display_address_flow_4_step
+);
+
+// a removal has no label to show
+UX_FLOW(ux_remove_contact_flow,
+       &ux_display_contact_flow_1_step,
+       &ux_display_contact_flow_3_step,
+       &ux_display_address_flow_3_step,
+       &ux_display_address_flow_4_step
+);
+
+void display_contact_confirmation_ui(action_t onApprove, action_t onReject) {
+    approval_action = onApprove;
+    rejection_action = onReject;
+
+    ux_flow_init(0, G_arena.contact.remove ? ux_remove_contact_flow : ux_display_contact_flow, NULL);
+}
@@ -22,4 +22,9 @@
 
 void display_address_confirmation_ui(char* address, action_t onApprove, action_t onReject);
 
+/**
+ * Shows the address book change held in 'G_arena.contact'.
+ */
+void display_contact_confirmation_ui(action_t onApprove, action_t onReject);
+
 #endif //LEDGER_APP_XYM_ADDRESSUI_H
\ No newline at end of file
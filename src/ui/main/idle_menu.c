@@ -19,6 +19,12 @@
 #include <os_io_seproxyhal.h>
 #include <ux.h>
 #include "glyphs.h"
+#include "storage.h"
+
+static char fastCosignValue[sizeof("Disabled")];
+
+static void update_fast_cosign_value(void);
+static void toggle_fast_cosign(void);
 
 UX_STEP_NOCB(
         ux_idle_flow_1_step,
@@ -37,6 +43,17 @@ UX_STEP_NOCB(
             APPVERSION,
         });
 
+// pressing both buttons switches the setting
+UX_STEP_CB_INIT(
+        ux_idle_flow_fast_cosign_step,
+        bn,
+        update_fast_cosign_value(),
+        toggle_fast_cosign(),
+        {
+            "Fast cosign",
+            fastCosignValue,
+        });
+
 UX_STEP_VALID(
         ux_idle_flow_3_step,
         pb,
@@ -49,10 +66,21 @@ UX_STEP_VALID(
 const ux_flow_step_t * const ux_idle_flow [] = {
         &ux_idle_flow_1_step,
         &ux_idle_flow_2_step,
+        &ux_idle_flow_fast_cosign_step,
         &ux_idle_flow_3_step,
         FLOW_END_STEP,
 };
 
+static void update_fast_cosign_value(void) {
+    strlcpy(fastCosignValue, N_storage.fastCosign ? "Enabled" : "Disabled", sizeof(fastCosignValue));
+}
+
+static void toggle_fast_cosign(void) {
+    uint8_t enabled = N_storage.fastCosign ? 0 : 1;
+    nvm_write((void*) &N_storage.fastCosign, &enabled, sizeof(enabled));
+    ux_flow_init(0, ux_idle_flow, &ux_idle_flow_fast_cosign_step);
+}
+
 void display_idle_menu() {
     if(G_ux.stack_count == 0) {
         ux_stack_push();
@@ -23,24 +23,58 @@
 #include "xym/format/fields.h"
 #include "xym/format/format.h"
 #include "glyphs.h"
-
-char fieldName[MAX_FIELDNAME_LEN];
-char fieldValue[MAX_FIELD_LEN];
+#include "arena.h"
+#include "trace.h"
+#include "address_book.h"
+#include "storage.h"
 
 static fields_array_t* fields;
 result_action_t approval_menu_callback;
 
-const ux_flow_step_t* ux_review_flow[MAX_FIELD_COUNT + 3];
+// Screen shown by the review step. Aggregates with several inner
+// transactions start with one index screen per inner transaction, pressing
+// both buttons jumps to it. Pressing both buttons on a field goes back to the
+// index screen of its inner transaction.
+typedef struct {
+    bool onIndex;       ///< true for an index screen
+    uint8_t item;       ///< inner transaction on an index screen, field otherwise
+    uint8_t page;       ///< page of the field
+} review_cursor_t;
 
-static void update_content(int stackSlot);
+static review_cursor_t cursor;
+static bool insideBorders;
 
-UX_STEP_NOCB_INIT(
+static void display_next_state(bool isUpperDelimiter);
+static void update_content(void);
+static void select_content(void);
+static void update_cosign_hash(void);
+
+// The review step is shown between two delimiters, reaching one of them
+// moves the cursor and shows the review step again, see 'display_next_state()'
+UX_STEP_INIT(
+        ux_review_upper_delimiter,
+        NULL,
+        NULL,
+        {
+            display_next_state(true);
+        });
+
+UX_STEP_CB_INIT(
         ux_review_flow_step,
         bnnn_paging,
-        update_content(stack_slot),
+        update_content(),
+        select_content(),
+        {
+            G_arena.review.fieldName,
+            G_arena.review.fieldValue
+        });
+
+UX_STEP_INIT(
+        ux_review_lower_delimiter,
+        NULL,
+        NULL,
         {
-            fieldName,
-            fieldValue
+            display_next_state(false);
         });
 
 UX_STEP_VALID(
@@ -61,38 +95,247 @@ UX_STEP_VALID(
             "Reject",
         });
 
-static void update_title(const field_t *field) {
-    memset(fieldName, 0, MAX_FIELDNAME_LEN);
-    resolve_fieldname(field, fieldName);
+// an aggregate of an unknown network, only the hash at its start is signed
+UX_STEP_NOCB(
+        ux_review_flow_warning,
+        pnn,
+        {
+            &C_icon_eye,
+            "Unknown network",
+            "only hash signed",
+        });
+
+// cosignature of a hash the host asked for, with the "Fast cosign" setting enabled
+UX_STEP_NOCB_INIT(
+        ux_cosign_flow_hash,
+        bnnn_paging,
+        update_cosign_hash(),
+        {
+            G_arena.review.fieldName,
+            G_arena.review.fieldValue
+        });
+
+UX_STEP_VALID(
+        ux_cosign_flow_sign,
+        pnn,
+        approval_menu_callback(OPTION_SIGN),
+        {
+            &C_icon_validate_14,
+            "Approve",
+            "cosignature",
+        });
+
+UX_FLOW(ux_cosign_flow,
+        &ux_cosign_flow_hash,
+        &ux_cosign_flow_sign,
+        &ux_review_flow_reject);
+
+UX_FLOW(ux_review_flow,
+        &ux_review_upper_delimiter,
+        &ux_review_flow_step,
+        &ux_review_lower_delimiter,
+        &ux_review_flow_sign,
+        &ux_review_flow_reject);
+
+UX_FLOW(ux_review_warning_flow,
+        &ux_review_flow_warning,
+        &ux_review_upper_delimiter,
+        &ux_review_flow_step,
+        &ux_review_lower_delimiter,
+        &ux_review_flow_sign,
+        &ux_review_flow_reject);
+
+// contact of an address field, NULL for the other fields and unknown addresses
+static const address_entry_t *field_contact(const field_t *field) {
+    if (field->dataType != STI_ADDRESS || field->length != XYM_ADDRESS_LENGTH) {
+        return NULL;
+    }
+    return address_book_find(field->data);
 }
 
+uint8_t review_page_count(const field_t *field) {
+    // the label of a contact, then its address
+    if (field_contact(field) != NULL) {
+        return 2;
+    }
+    return field_page_count(field);
+}
 
-static void update_value(const field_t *field) {
-    memset(fieldValue, 0, MAX_FIELD_LEN);
-    format_field(field, fieldValue);
+void review_page_title(const field_t *field, uint8_t page, char *dst) {
+    const uint8_t pageCount = review_page_count(field);
+    memset(dst, 0, MAX_FIELDNAME_LEN);
+    resolve_fieldname(field, dst);
+    if (pageCount > 1) {
+        const size_t len = strlen(dst);
+        snprintf(dst + len, MAX_FIELDNAME_LEN - len, " (%d/%d)", page + 1, pageCount);
+    }
 }
 
-static void update_content(int stackSlot) {
-    int stepIndex = G_ux.flow_stack[stackSlot].index;
-    const field_t *field = &fields->arr[stepIndex];
-    update_title(field);
-    update_value(field);
+void review_page_value(const field_t *field, uint8_t page, char *dst) {
+    const address_entry_t *contact = field_contact(field);
+    if (contact == NULL) {
+        format_field_page(field, page, dst);
+    } else if (page == 0) {
+        memset(dst, 0, MAX_FIELD_LEN);
+        snprintf(dst, MAX_FIELD_LEN, "%s (verified)", contact->label);
+    } else {
+        format_field(field, dst);
+    }
+}
+
+static bool has_index(void) {
+    return fields->innerCount > 1;
+}
+
+static void first_screen(void) {
+    cursor.onIndex = has_index();
+    cursor.item = 0;
+    cursor.page = 0;
+}
+
+static void last_screen(void) {
+    cursor.onIndex = false;
+    cursor.item = fields->numFields - 1;
+    cursor.page = review_page_count(&fields->arr[cursor.item]) - 1;
+}
+
+static bool next_screen(void) {
+    if (cursor.onIndex) {
+        if (cursor.item + 1 < fields->innerCount) {
+            cursor.item++;
+        } else {
+            cursor.onIndex = false;
+            cursor.item = 0;
+            cursor.page = 0;
+        }
+    } else if (cursor.page + 1 < review_page_count(&fields->arr[cursor.item])) {
+        cursor.page++;
+    } else if (cursor.item + 1 < fields->numFields) {
+        cursor.item++;
+        cursor.page = 0;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool previous_screen(void) {
+    if (cursor.onIndex) {
+        if (cursor.item == 0) {
+            return false;
+        }
+        cursor.item--;
+    } else if (cursor.page > 0) {
+        cursor.page--;
+    } else if (cursor.item > 0) {
+        cursor.item--;
+        cursor.page = review_page_count(&fields->arr[cursor.item]) - 1;
+    } else if (has_index()) {
+        cursor.onIndex = true;
+        cursor.item = fields->innerCount - 1;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static void display_next_state(bool isUpperDelimiter) {
+    if (isUpperDelimiter) {
+        // the review starts, or the user goes back from the first screen and stays on it
+        if (!insideBorders) {
+            insideBorders = true;
+            first_screen();
+        } else {
+            previous_screen();
+        }
+        ux_flow_next();
+    } else if (!insideBorders) {
+        // back from the approval steps
+        insideBorders = true;
+        last_screen();
+        ux_flow_prev();
+    } else if (next_screen()) {
+        ux_flow_prev();
+    } else {
+        insideBorders = false;
+        ux_flow_next();
+    }
+}
+
+static void update_value(const field_t *field, uint8_t page) {
+    TRACE(TRACE_FORMAT_BEGIN, field->id);
+    review_page_value(field, page, G_arena.review.fieldValue);
+    TRACE(TRACE_FORMAT_END, field->id);
+}
+
+static void update_index(uint8_t innerIndex) {
+    // title is the position of the inner transaction, value its type
+    memset(G_arena.review.fieldName, 0, MAX_FIELDNAME_LEN);
+    snprintf(G_arena.review.fieldName, MAX_FIELDNAME_LEN, "Inner TX %d/%d", innerIndex + 1, fields->innerCount);
+    const field_t *type = &fields->arr[fields->innerStart[innerIndex]];
+    TRACE(TRACE_FORMAT_BEGIN, type->id);
+    format_field(type, G_arena.review.fieldValue);
+    TRACE(TRACE_FORMAT_END, type->id);
+}
+
+static void update_content(void) {
+    if (cursor.onIndex) {
+        update_index(cursor.item);
+        return;
+    }
+
+    const field_t *field = &fields->arr[cursor.item];
+    review_page_title(field, cursor.page, G_arena.review.fieldName);
+    update_value(field, cursor.page);
 #ifdef HAVE_PRINTF
-    PRINTF("\nPage %d - Title: %s - Value: %s\n", stepIndex, fieldName, fieldValue);
+    PRINTF("\nPage %d - Title: %s - Value: %s\n", cursor.page, G_arena.review.fieldName, G_arena.review.fieldValue);
 #endif
 }
 
-void display_review_menu(fields_array_t *transactionParam, result_action_t callback) {
-    fields = transactionParam;
-    approval_menu_callback = callback;
+static void select_content(void) {
+    if (!has_index()) {
+        return;
+    }
+
+    if (cursor.onIndex) {
+        // jump to the first field of the inner transaction
+        cursor.onIndex = false;
+        cursor.item = fields->innerStart[cursor.item];
+        cursor.page = 0;
+    } else {
+        // back to the index screen of the inner transaction of this field
+        uint8_t innerIndex = 0;
+        while (innerIndex + 1 < fields->innerCount && fields->innerStart[innerIndex + 1] <= cursor.item) {
+            innerIndex++;
+        }
+        cursor.onIndex = true;
+        cursor.item = innerIndex;
+    }
+    ux_flow_relayout();
+}
 
-    for (int i = 0; i < fields->numFields; ++i) {
-        ux_review_flow[i] = &ux_review_flow_step;
+static void update_cosign_hash(void) {
+    // the hash that is signed, on as many pages as it takes
+    for (uint8_t i = 0; i < fields->numFields; i++) {
+        const field_t *field = &fields->arr[i];
+        if (field->id == XYM_HASH256_AGG_HASH) {
+            review_page_title(field, 0, G_arena.review.fieldName);
+            review_page_value(field, 0, G_arena.review.fieldValue);
+            return;
+        }
     }
+}
 
-    ux_review_flow[fields->numFields + 0] = &ux_review_flow_sign;
-    ux_review_flow[fields->numFields + 1] = &ux_review_flow_reject;
-    ux_review_flow[fields->numFields + 2] = FLOW_END_STEP;
+void display_review_menu(fields_array_t *transactionParam, bool cosignature, result_action_t callback) {
+    fields = transactionParam;
+    approval_menu_callback = callback;
+    insideBorders = false;
 
-    ux_flow_init(0, ux_review_flow, NULL);
+    if (cosignature && N_storage.fastCosign) {
+        ux_flow_init(0, ux_cosign_flow, NULL);
+    } else if (!cosignature && fields->signLength == XYM_TRANSACTION_HASH_LENGTH) {
+        ux_flow_init(0, ux_review_warning_flow, NULL);
+    } else {
+        ux_flow_init(0, ux_review_flow, NULL);
+    }
 }
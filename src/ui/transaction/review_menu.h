@@ -23,6 +23,30 @@
 #define OPTION_SIGN 0
 #define OPTION_REJECT 1
 
-void display_review_menu(fields_array_t* parsedFields, result_action_t callback);
+/**
+ * Shows the fields for approval. The cosignature of a hash the host asked
+ * for ('cosignature') is approved on the hash alone when the "Fast cosign"
+ * setting is enabled. Any other request that only signs the hash at its
+ * start is reviewed in full after a warning.
+ */
+void display_review_menu(fields_array_t* parsedFields, bool cosignature, result_action_t callback);
+
+/**
+ * Screens of a field in the review. An address of the address book is shown
+ * as its label first and as its address on a second page, the other fields
+ * are paged as in 'field_page_count()'.
+ */
+uint8_t review_page_count(const field_t* field);
+
+/**
+ * Title of page 'page' of 'field' with its position when there are several,
+ * 'dst' holds MAX_FIELDNAME_LEN characters.
+ */
+void review_page_title(const field_t* field, uint8_t page, char* dst);
+
+/**
+ * Value of page 'page' of 'field', 'dst' holds MAX_FIELD_LEN characters.
+ */
+void review_page_value(const field_t* field, uint8_t page, char* dst);
 
 #endif //LEDGER_APP_XYM_REVIEWMENU_H
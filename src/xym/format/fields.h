@@ -39,6 +39,7 @@
 #define STI_HEX_MESSAGE 0xA4
 #define STI_UINT8_ADDITION 0xA5
 #define STI_UINT8_DELETION 0xA6
+#define STI_MOSAIC 0xA7
 
 // Small collection of used field IDs
 #define XYM_INT8_MAM_REMOVAL_DELTA 0x01
@@ -59,6 +60,9 @@
 #define XYM_UINT8_AA_RESTRICTION 0x1C
 #define XYM_UINT8_AM_RESTRICTION 0x1D
 #define XYM_UINT8_AO_RESTRICTION 0x1E
+#define XYM_UINT8_AA_RESTRICTION_DEL 0x1F
+#define XYM_UINT8_AM_RESTRICTION_DEL 0x21
+#define XYM_UINT8_AO_RESTRICTION_DEL 0x22
 
 #define XYM_INT16_VALUE_DELTA 0x20
 
@@ -72,6 +76,9 @@
 
 #define XYM_UINT32_VKL_START_POINT 0x50
 #define XYM_UINT32_VKL_END_POINT 0x51
+#define XYM_UINT32_AGG_INNER_COUNT 0x52
+#define XYM_UINT32_AGG_RECIPIENT_COUNT 0x53
+#define XYM_UINT32_AGG_MESSAGE_COUNT 0x54
 
 #define XYM_UINT64_TXN_FEE 0x70
 #define XYM_UINT64_DURATION 0x71
@@ -93,9 +100,7 @@
 #define XYM_STR_METADATA_VALUE 0x94
 #define XYM_STR_METADATA_ADDRESS 0x95
 #define XYM_STR_TXN_HARVESTING 0x96
-#define XYM_STR_TXN_HARVESTING_1 0x97
-#define XYM_STR_TXN_HARVESTING_2 0x98
-#define XYM_STR_TXN_HARVESTING_3 0x99
+#define XYM_STR_RECIPIENT_ALIAS 0x97
 
 #define XYM_HASH256_AGG_HASH 0xB0
 #define XYM_HASH256_HL_HASH 0xB1
@@ -103,6 +108,7 @@
 #define XYM_MOSAIC_HL_QUANTITY 0xD0
 #define XYM_MOSAIC_AMOUNT 0xD1
 #define XYM_UNKNOWN_MOSAIC 0xD2
+#define XYM_MOSAIC_TOTAL 0xD3
 
 typedef struct {
     uint8_t id;
@@ -111,9 +117,69 @@ typedef struct {
     const uint8_t *data;
 } field_t;
 
-// Simple macro for building more readable switch statements
-#define CASE_FIELDNAME(v,src) case v: snprintf(dst, MAX_FIELDNAME_LEN, "%s", src); return;
-
-void resolve_fieldname(const field_t *field, char* dst);
+/**
+ * Every field that can be shown: its id, the type of its data, its label and
+ * the formatter of its value. Ids are unique, the table is expanded into the
+ * lookup tables of 'format.c'.
+ */
+#define XYM_FIELD_TABLE(X) \
+    X(XYM_INT8_MAM_REMOVAL_DELTA,           STI_INT8,            "Min Removal",        int8_formatter)         \
+    X(XYM_INT8_MAM_APPROVAL_DELTA,          STI_INT8,            "Min Approval",       int8_formatter)         \
+    X(XYM_UINT8_TXN_MESSAGE_TYPE,           STI_UINT8,           "Message Type",       uint8_formatter)        \
+    X(XYM_UINT8_MOSAIC_COUNT,               STI_UINT8,           "Mosaics",            uint8_formatter)        \
+    X(XYM_UINT8_MSC_ACTION,                 STI_UINT8,           "Change Direction",   uint8_formatter)        \
+    X(XYM_UINT8_NS_REG_TYPE,                STI_UINT8,           "Namespace Type",     uint8_formatter)        \
+    X(XYM_UINT8_AA_TYPE,                    STI_UINT8,           "Alias Type",         uint8_formatter)        \
+    X(XYM_UINT8_MD_DIV,                     STI_UINT8,           "Divisibility",       uint8_formatter)        \
+    X(XYM_UINT8_KL_TYPE,                    STI_UINT8,           "Action",             uint8_formatter)        \
+    X(XYM_UINT8_MD_TRANS_FLAG,              STI_UINT8,           "Transferable",       uint8_formatter)        \
+    X(XYM_UINT8_MD_SUPPLY_FLAG,             STI_UINT8,           "Supply Mutable",     uint8_formatter)        \
+    X(XYM_UINT8_MD_RESTRICT_FLAG,           STI_UINT8,           "Restrictable",       uint8_formatter)        \
+    X(XYM_UINT8_MAM_ADD_COUNT,              STI_UINT8,           "Address Add Num",    uint8_formatter)        \
+    X(XYM_UINT8_MAM_DEL_COUNT,              STI_UINT8,           "Address Del Num",    uint8_formatter)        \
+    X(XYM_UINT8_AA_RESTRICTION,             STI_UINT8_ADDITION,  "Addition Count",     uint8_custom_formatter) \
+    X(XYM_UINT8_AM_RESTRICTION,             STI_UINT8_ADDITION,  "Addition Count",     uint8_custom_formatter) \
+    X(XYM_UINT8_AO_RESTRICTION,             STI_UINT8_ADDITION,  "Addition Count",     uint8_custom_formatter) \
+    X(XYM_UINT8_AA_RESTRICTION_DEL,         STI_UINT8_DELETION,  "Deletion Count",     uint8_custom_formatter) \
+    X(XYM_UINT8_AM_RESTRICTION_DEL,         STI_UINT8_DELETION,  "Deletion Count",     uint8_custom_formatter) \
+    X(XYM_UINT8_AO_RESTRICTION_DEL,         STI_UINT8_DELETION,  "Deletion Count",     uint8_custom_formatter) \
+    X(XYM_INT16_VALUE_DELTA,                STI_INT16,           "Value Size Delta",   int16_formatter)        \
+    X(XYM_UINT16_TRANSACTION_TYPE,          STI_UINT16,          "Transaction Type",   uint16_formatter)       \
+    X(XYM_UINT16_INNER_TRANSACTION_TYPE,    STI_UINT16,          "Inner TX Type",      uint16_formatter)       \
+    X(XYM_UINT16_TRANSACTION_DETAIL_TYPE,   STI_UINT16,          "Detail TX Type",     uint16_formatter)       \
+    X(XYM_UINT16_ENTITY_RESTRICT_OPERATION, STI_UINT16,          "Operation Type",     uint16_formatter)       \
+    X(XYM_UINT16_AR_RESTRICT_TYPE,          STI_UINT16,          "Restriction Flag",   uint16_formatter)       \
+    X(XYM_UINT16_AR_RESTRICT_DIRECTION,     STI_UINT16,          "Restriction Flag",   uint16_formatter)       \
+    X(XYM_UINT16_AR_RESTRICT_OPERATION,     STI_UINT16,          "Restriction Flag",   uint16_formatter)       \
+    X(XYM_UINT32_VKL_START_POINT,           STI_UINT32,          "Start point",        uint32_formatter)       \
+    X(XYM_UINT32_VKL_END_POINT,             STI_UINT32,          "End point",          uint32_formatter)       \
+    X(XYM_UINT32_AGG_INNER_COUNT,           STI_UINT32,          "Inner Transfers",    uint32_formatter)       \
+    X(XYM_UINT32_AGG_RECIPIENT_COUNT,       STI_UINT32,          "Recipients",         uint32_formatter)       \
+    X(XYM_UINT32_AGG_MESSAGE_COUNT,         STI_UINT32,          "With Message",       uint32_formatter)       \
+    X(XYM_UINT64_DURATION,                  STI_UINT64,          "Duration",           uint64_formatter)       \
+    X(XYM_UINT64_PARENTID,                  STI_UINT64,          "Parent ID",          uint64_formatter)       \
+    X(XYM_UINT64_MSC_AMOUNT,                STI_UINT64,          "Change Amount",      uint64_formatter)       \
+    X(XYM_UINT64_NS_ID,                     STI_UINT64,          "Namespace ID",       uint64_formatter)       \
+    X(XYM_UINT64_MOSAIC_ID,                 STI_UINT64,          "Mosaic ID",          uint64_formatter)       \
+    X(XYM_UINT64_METADATA_KEY,              STI_UINT64,          "Metadata Key",       uint64_formatter)       \
+    X(XYM_HASH256_AGG_HASH,                 STI_HASH256,         "Agg. Tx Hash",       hash_formatter)         \
+    X(XYM_HASH256_HL_HASH,                  STI_HASH256,         "Tx Hash",            hash_formatter)         \
+    X(XYM_PUBLICKEY_ACCOUNT_KEY_LINK,       STI_PUBLIC_KEY,      "Linked Acct. PbK",   hash_formatter)         \
+    X(XYM_PUBLICKEY_NODE_KEY_LINK,          STI_PUBLIC_KEY,      "Linked Node PbK",    hash_formatter)         \
+    X(XYM_PUBLICKEY_VOTING_KEY_LINK,        STI_PUBLIC_KEY,      "Linked Vot. PbK",    hash_formatter)         \
+    X(XYM_PUBLICKEY_VRF_KEY_LINK,           STI_PUBLIC_KEY,      "Linked Vrf PbK",     hash_formatter)         \
+    X(XYM_STR_RECIPIENT_ADDRESS,            STI_ADDRESS,         "Recipient",          address_formatter)      \
+    X(XYM_STR_METADATA_ADDRESS,             STI_ADDRESS,         "Target Address",     address_formatter)      \
+    X(XYM_STR_ADDRESS,                      STI_ADDRESS,         "Address",            address_formatter)      \
+    X(XYM_MOSAIC_AMOUNT,                    STI_MOSAIC_CURRENCY, "Amount",             mosaic_formatter)       \
+    X(XYM_MOSAIC_HL_QUANTITY,               STI_MOSAIC_CURRENCY, "Lock Quantity",      mosaic_formatter)       \
+    X(XYM_MOSAIC_TOTAL,                     STI_MOSAIC_CURRENCY, "Total",              mosaic_formatter)       \
+    X(XYM_UINT64_TXN_FEE,                   STI_XYM,             "Fee",                xym_formatter)          \
+    X(XYM_STR_TXN_MESSAGE,                  STI_MESSAGE,         "Message",            msg_formatter)          \
+    X(XYM_STR_METADATA_VALUE,               STI_MESSAGE,         "Value",              msg_formatter)          \
+    X(XYM_STR_TXN_HARVESTING,               STI_HEX_MESSAGE,     "Harvesting Message", hex_msg_formatter)      \
+    X(XYM_UNKNOWN_MOSAIC,                   STI_STR,             "Unknown Mosaic",     string_formatter)       \
+    X(XYM_STR_RECIPIENT_ALIAS,              STI_STR,             "Recipient",          string_formatter)       \
+    X(XYM_STR_NAMESPACE,                    STI_STR,             "Name",               string_formatter)
 
 #endif //LEDGER_APP_XYM_FIELDS_H
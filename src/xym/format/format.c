@@ -21,7 +21,6 @@
 #include "fields.h"
 #include "readers.h"
 #include "printers.h"
-#include "apdu/global.h"
 #include "xym/xym_helpers.h"
 #include "common.h"
 #include "base32.h"
@@ -112,11 +111,11 @@ static void uint8_formatter(const field_t *field, char *dst) {
 static void uint8_custom_formatter(const field_t *field, char *dst) {
     uint8_t value = read_uint8(field->data);
     if (value != 0) {
-        if (field->id == XYM_UINT8_AA_RESTRICTION) {
+        if (field->id == XYM_UINT8_AA_RESTRICTION || field->id == XYM_UINT8_AA_RESTRICTION_DEL) {
             SNPRINTF(dst, "%d %s", value, "address(es)");
-        } else if (field->id == XYM_UINT8_AM_RESTRICTION) {
+        } else if (field->id == XYM_UINT8_AM_RESTRICTION || field->id == XYM_UINT8_AM_RESTRICTION_DEL) {
             SNPRINTF(dst, "%d %s", value, "mosaic(s)");
-        } else if (field->id == XYM_UINT8_AO_RESTRICTION) {
+        } else if (field->id == XYM_UINT8_AO_RESTRICTION || field->id == XYM_UINT8_AO_RESTRICTION_DEL) {
             SNPRINTF(dst, "%d %s", value, "operation(s)");
         }
     } else {
@@ -180,8 +179,21 @@ static void uint16_formatter(const field_t *field, char *dst) {
 
 static void uint32_formatter(const field_t *field, char *dst) {
     uint32_t value = read_uint32(field->data);
-    if ((field->id == XYM_UINT32_VKL_START_POINT) || (field->id == XYM_UINT32_VKL_END_POINT)) {
-        SNPRINTF(dst, "%d", value);
+    switch (field->id) {
+        case XYM_UINT32_VKL_START_POINT:
+        case XYM_UINT32_VKL_END_POINT:
+        case XYM_UINT32_AGG_RECIPIENT_COUNT:
+            // a summary stops counting recipients past the ones it lists
+            if (value > MAX_SUMMARY_RECIPIENTS) {
+                SNPRINTF(dst, "More than %d", MAX_SUMMARY_RECIPIENTS);
+                break;
+            }
+            SNPRINTF(dst, "%d", value);
+            break;
+        case XYM_UINT32_AGG_INNER_COUNT:
+        case XYM_UINT32_AGG_MESSAGE_COUNT:
+            SNPRINTF(dst, "%d", value);
+            break;
     }
 }
 
@@ -213,14 +225,11 @@ static void address_formatter(const field_t *field, char *dst) {
 }
 
 static void mosaic_formatter(const field_t *field, char *dst) {
+    const mosaic_t* value = (const mosaic_t *)field->data;
     if (field->dataType == STI_MOSAIC_CURRENCY) {
-        const mosaic_t* value = (const mosaic_t *)field->data;
-        bool is_using_mainnet = (transactionContext.bip32Path[1] & 0x7FFFFFFF) == 4343 ? true : false;
-        if ((value->mosaicId == (is_using_mainnet ? XYM_MAINNET_MOSAIC_ID : XYM_TESTNET_MOSAIC_ID)) || field->id == XYM_MOSAIC_HL_QUANTITY) {
-            xym_print_amount(value->amount, 6, "XYM", dst, MAX_FIELD_LEN);
-        } else {
-            snprintf_mosaic(dst, MAX_FIELD_LEN, value, "micro");
-        }
+        xym_print_amount(value->amount, 6, "XYM", dst, MAX_FIELD_LEN);
+    } else if (field->dataType == STI_MOSAIC) {
+        snprintf_mosaic(dst, MAX_FIELD_LEN, value, "micro");
     }
 }
 
@@ -251,7 +260,7 @@ static void msg_formatter(const field_t *field, char *dst) {
 static void string_formatter(const field_t *field, char *dst) {
     if (field->id == XYM_UNKNOWN_MOSAIC) {
         SNPRINTF(dst, "%s", "Divisibility and levy cannot be shown");
-    } else if (field->id == XYM_STR_RECIPIENT_ADDRESS) {
+    } else if (field->id == XYM_STR_RECIPIENT_ALIAS) {
         SNPRINTF(dst, "%s", "alias to a namespace");
     } else if (field->length > MAX_FIELD_LEN) {
         snprintf_ascii(dst, MAX_FIELD_LEN, field->data, MAX_FIELD_LEN - 1);
@@ -260,50 +269,91 @@ static void string_formatter(const field_t *field, char *dst) {
     }
 }
 
-static field_formatter_t get_formatter(const field_t *field) {
+typedef struct {
+    uint8_t dataType;
+    const char *label;
+    field_formatter_t formatter;
+} field_descriptor_t;
+
+// Row of each field in FIELD_DESCRIPTORS
+#define FIELD_ROW(id, dataType, label, formatter) FIELD_ROW_##id,
+enum { XYM_FIELD_TABLE(FIELD_ROW) FIELD_ROW_COUNT };
+
+#define FIELD_DESCRIPTOR(id, dataType, label, formatter) { dataType, label, formatter },
+static const field_descriptor_t FIELD_DESCRIPTORS[FIELD_ROW_COUNT] = { XYM_FIELD_TABLE(FIELD_DESCRIPTOR) };
+
+// Row of each field id plus one, 0 for unknown ids
+#define FIELD_ROW_OF_ID(id, dataType, label, formatter) [id] = FIELD_ROW_##id + 1,
+static const uint8_t FIELD_ROWS[256] = { XYM_FIELD_TABLE(FIELD_ROW_OF_ID) };
+
+// The parser tells apart amounts of the network currency from other mosaics,
+// the table only lists the former
+static uint8_t descriptor_data_type(uint8_t dataType) {
+    return (dataType == STI_MOSAIC) ? STI_MOSAIC_CURRENCY : dataType;
+}
+
+static const field_descriptor_t *get_descriptor(const field_t *field) {
+    const uint8_t row = FIELD_ROWS[field->id];
+    if (row == 0 || FIELD_DESCRIPTORS[row - 1].dataType != descriptor_data_type(field->dataType)) {
+        return NULL;
+    }
+    return &FIELD_DESCRIPTORS[row - 1];
+}
+
+const char *get_field_name(const field_t *field) {
+    const field_descriptor_t *descriptor = get_descriptor(field);
+    return (descriptor != NULL) ? descriptor->label : "Unknown Field";
+}
+
+void resolve_fieldname(const field_t *field, char *dst) {
+    snprintf(dst, MAX_FIELDNAME_LEN, "%s", get_field_name(field));
+}
+
+// Number of data bytes shown on one page, 0 if the field is never split
+static uint16_t page_data_length(const field_t *field) {
     switch (field->dataType) {
-        case STI_INT8:
-            return int8_formatter;
-        case STI_UINT8:
-            return uint8_formatter;
-        case STI_UINT8_ADDITION:
-        case STI_UINT8_DELETION:
-            return uint8_custom_formatter;
-        case STI_INT16:
-            return int16_formatter;
-        case STI_UINT16:
-            return uint16_formatter;
-        case STI_UINT32:
-            return uint32_formatter;
-        case STI_UINT64:
-            return uint64_formatter;
-        case STI_HASH256:
-            return hash_formatter;
-        case STI_PUBLIC_KEY:
-            return hash_formatter;
-        case STI_ADDRESS:
-            return address_formatter;
-        case STI_MOSAIC_CURRENCY:
-            return mosaic_formatter;
-        case STI_XYM:
-            return xym_formatter;
         case STI_MESSAGE:
-            return msg_formatter;
-        case STI_HEX_MESSAGE:
-            return hex_msg_formatter;
         case STI_STR:
-            return string_formatter;
+            return MAX_FIELD_LEN - 1;
+        case STI_HEX_MESSAGE:
+            return MAX_FIELD_LEN/2 - 1;
         default:
-            return NULL;
+            return 0;
+    }
+}
+
+uint8_t field_page_count(const field_t *field) {
+    const uint16_t pageLength = page_data_length(field);
+    if (pageLength == 0 || field->length <= pageLength) {
+        return 1;
+    }
+    return (field->length + pageLength - 1) / pageLength;
+}
+
+void format_field_page(const field_t *field, uint8_t page, char *dst) {
+    const uint16_t pageLength = page_data_length(field);
+    if (pageLength == 0 || field->length <= pageLength || page >= field_page_count(field)) {
+        format_field(field, dst);
+        return;
+    }
+
+    // a page is rendered straight from the raw transaction, only the
+    // characters of that page are written to 'dst'
+    const uint16_t offset = page * pageLength;
+    const uint16_t length = (field->length - offset < pageLength) ? (field->length - offset) : pageLength;
+    if (field->dataType == STI_HEX_MESSAGE) {
+        snprintf_hex2ascii(dst, MAX_FIELD_LEN, &field->data[offset], length);
+    } else {
+        snprintf_ascii(dst, MAX_FIELD_LEN, &field->data[offset], length);
     }
 }
 
 void format_field(const field_t *field, char *dst) {
     memset(dst, 0, MAX_FIELD_LEN);
 
-    field_formatter_t formatter = get_formatter(field);
-    if (formatter != NULL) {
-        formatter(field, dst);
+    const field_descriptor_t *descriptor = get_descriptor(field);
+    if (descriptor != NULL) {
+        descriptor->formatter(field, dst);
     } else {
         SNPRINTF(dst, "%s", "[Not implemented]");
     }
@@ -26,4 +26,28 @@
 
 void format_field(const field_t *field, char *dst);
 
+/**
+ * Returns the label of 'field', a constant string.
+ */
+const char *get_field_name(const field_t *field);
+
+/**
+ * Copies the label of 'field' into 'dst' (MAX_FIELDNAME_LEN characters).
+ */
+void resolve_fieldname(const field_t *field, char *dst);
+
+/**
+ * Fields whose data is shown as text (messages, strings, hex messages)
+ * are split into pages when they do not fit in MAX_FIELD_LEN characters.
+ * Returns the number of pages of 'field', 1 for all other fields.
+ */
+uint8_t field_page_count(const field_t *field);
+
+/**
+ * Formats page 'page' (0 based) of 'field', see 'field_page_count()'.
+ * Pages of long fields are rendered directly from the field data, only the
+ * characters of the requested page are written to 'dst'.
+ */
+void format_field_page(const field_t *field, uint8_t page, char *dst);
+
 #endif //LEDGER_APP_XYM_FORMAT_H
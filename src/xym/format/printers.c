@@ -17,10 +17,10 @@
 ********************************************************************************/
 #include <string.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "printers.h"
-
-#if defined(FUZZ)
-#include <bsd/string.h>
+#ifdef HAVE_CODEC_KERNELS
+#include "codec.h"
 #endif
 
 int snprintf_number(char *dst, uint16_t len, uint64_t value) {
@@ -56,6 +56,13 @@ int snprintf_hex2ascii(char *dst, uint16_t maxLen, const uint8_t *src, uint16_t
     if (2 * dataLength > maxLen - 1 || maxLen < 1 || dataLength < 1) {
         return E_NOT_ENOUGH_DATA;
     }
+#ifdef HAVE_CODEC_KERNELS
+    if (codec_kernel() != CODEC_SCALAR) {
+        codec_hex(src, dataLength, dst, false);
+        dst[2*dataLength] = '\0';
+        return 2*dataLength;
+    }
+#endif
     for (uint16_t i = 0; i < dataLength; i++) {
         dst[2*i] = hex2ascii((src[i] & 0xf0) >> 4);
         dst[2*i+1] = hex2ascii(src[i] & 0x0f);
@@ -68,6 +75,13 @@ int snprintf_hex(char *dst, uint16_t maxLen, const uint8_t *src, uint16_t dataLe
     if (2 * dataLength > maxLen - 1 || maxLen < 1 || dataLength < 1) {
         return E_NOT_ENOUGH_DATA;
     }
+#ifdef HAVE_CODEC_KERNELS
+    if (codec_kernel() != CODEC_SCALAR) {
+        codec_hex(src, dataLength, dst, reverse == 1);
+        dst[2*dataLength] = '\0';
+        return 2*dataLength;
+    }
+#endif
     for (uint16_t i = 0; i < dataLength; i++) {
         snprintf(dst + 2 * i, maxLen - 2 * i, "%02X", reverse==1?src[dataLength-1-i]:src[i]);
     }
@@ -104,10 +118,9 @@ int snprintf_mosaic(char *dst, uint16_t maxLen, const mosaic_t *mosaic, char *as
     if(snprintf_number(dst, maxLen, mosaic->amount) < 1) {
         return E_NOT_ENOUGH_DATA;
     };
-    strlcat(dst, " ", maxLen);
-    strlcat(dst, asset, maxLen);
-    strlcat(dst, " 0x", maxLen);
     uint16_t len = strlen(dst);
+    snprintf(dst + len, maxLen - len, " %s 0x", asset);
+    len = strlen(dst);
     const uint8_t* mosaicId = (const uint8_t*) &mosaic->mosaicId;
     char* mosaicHex = dst + len;
     if(snprintf_hex(mosaicHex, maxLen - len, mosaicId, sizeof(uint64_t), 1) < 1) {
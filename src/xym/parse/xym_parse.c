@@ -16,7 +16,7 @@
 ********************************************************************************/
 
 #include "xym_parse.h"
-#include "apdu/global.h"
+#include <string.h>
 #include "xym/format/printers.h"
 
 #pragma pack(push, 1)
@@ -162,6 +162,30 @@ static int add_new_field( fields_array_t* fields, uint8_t id, uint8_t data_type,
 }
 
 
+// amounts of the network currency are shown in XYM, other mosaics in their raw unit
+static uint8_t mosaic_data_type( const mosaic_t* mosaic, const fields_array_t* fields )
+{
+    const uint64_t mosaic_net_id = (fields->isMainnet ? XYM_MAINNET_MOSAIC_ID : XYM_TESTNET_MOSAIC_ID);
+    return (mosaic->mosaicId == mosaic_net_id) ? STI_MOSAIC_CURRENCY : STI_MOSAIC;
+}
+
+
+static int add_recipient_fields( fields_array_t* fields, const uint8_t* recipientAddress )
+{
+    if( recipientAddress[0] == MAINNET_NETWORK_TYPE || recipientAddress[0] == TESTNET_NETWORK_TYPE ) 
+    {
+        BAIL_IF( add_new_field(fields, XYM_STR_RECIPIENT_ADDRESS, STI_ADDRESS, XYM_ADDRESS_LENGTH, recipientAddress) ); // add recipient address
+    } 
+    else 
+    {        
+        BAIL_IF( add_new_field(fields, XYM_STR_RECIPIENT_ALIAS,   STI_STR,    0,                &recipientAddress[0]) ); // add recipient alias to namespace notification
+        BAIL_IF( add_new_field(fields, XYM_UINT64_NS_ID,          STI_UINT64, sizeof(uint64_t), &recipientAddress[1]) ); // add alias namespace ID
+    }
+
+    return E_SUCCESS;
+}
+
+
 
 
 /**
@@ -203,23 +227,14 @@ static int parse_transfer_txn_content( buffer_t* rawTxData, fields_array_t* fiel
     uint32_t length = txn->mosaicsCount * sizeof(mosaic_t) + txn->messageSize;
     if( !buffer_can_read(rawTxData, length) ) { return E_INVALID_DATA; } 
 
-    if( txn->recipientAddress[0] == MAINNET_NETWORK_TYPE || txn->recipientAddress[0] == TESTNET_NETWORK_TYPE ) 
-    {
-        BAIL_IF( add_new_field(fields, XYM_STR_RECIPIENT_ADDRESS, STI_ADDRESS, XYM_ADDRESS_LENGTH, (const uint8_t*) txn->recipientAddress) ); // add recipient address
-    } 
-    else 
-    {        
-        BAIL_IF( add_new_field(fields, XYM_STR_RECIPIENT_ADDRESS, STI_STR,    0,                (const uint8_t*) &txn->recipientAddress[0]) ); // add recipient alias to namespace notification
-        BAIL_IF( add_new_field(fields, XYM_UINT64_NS_ID,          STI_UINT64, sizeof(uint64_t), (const uint8_t*) &txn->recipientAddress[1]) ); // add alias namespace ID
-    }
+    BAIL_IF( add_recipient_fields(fields, txn->recipientAddress) );
     
     if( txn->mosaicsCount > 1 )
     {
         BAIL_IF( add_new_field(fields, XYM_UINT8_MOSAIC_COUNT, STI_UINT8, sizeof(uint8_t), (const uint8_t*) &txn->mosaicsCount) ); // add sent mosaic count field
     }
 
-    const bool     is_using_mainnet = (transactionContext.bip32Path[1] & 0x7FFFFFFF) == 4343; // checks if the coin_type field of bip32 path is 'symbol'
-    const uint64_t mosaic_net_id    = (is_using_mainnet ? XYM_MAINNET_MOSAIC_ID : XYM_TESTNET_MOSAIC_ID);
+    const uint64_t mosaic_net_id = (fields->isMainnet ? XYM_MAINNET_MOSAIC_ID : XYM_TESTNET_MOSAIC_ID);
 
     // Show mosaics amounts
     for( uint8_t i = 0; i < txn->mosaicsCount; i++ ) 
@@ -239,7 +254,7 @@ static int parse_transfer_txn_content( buffer_t* rawTxData, fields_array_t* fiel
             BAIL_IF( add_new_field(fields, XYM_UNKNOWN_MOSAIC, STI_STR, 0, (const uint8_t*) mosaic) ); // Unknow mosaic notification
         }
 
-        BAIL_IF( add_new_field(fields, XYM_MOSAIC_AMOUNT, STI_MOSAIC_CURRENCY, sizeof(mosaic_t), (const uint8_t*) mosaic) );
+        BAIL_IF( add_new_field(fields, XYM_MOSAIC_AMOUNT, mosaic_data_type(mosaic, fields), sizeof(mosaic_t), (const uint8_t*) mosaic) );
     }
 
     if( txn->messageSize == 0 ) 
@@ -256,14 +271,8 @@ static int parse_transfer_txn_content( buffer_t* rawTxData, fields_array_t* fiel
 
         if (*msgType == XYM_PERSISTENT_DELEGATED_HARVESTING) // TODO: just do one read in a new buffer_t above, and use that below, instead of doing multiple seeks
         {
-            // Show persistent harvesting delegation message
-        #if defined(TARGET_NANOX) || defined(TARGET_NANOS2)
-            BAIL_IF( add_new_field(fields, XYM_STR_TXN_HARVESTING, STI_HEX_MESSAGE, txn->messageSize,      buffer_offset_ptr_and_seek( rawTxData, txn->messageSize)) );
-        #elif defined(TARGET_NANOS)
-            BAIL_IF( add_new_field(fields, XYM_STR_TXN_HARVESTING_1, STI_HEX_MESSAGE, MAX_FIELD_LEN/2 - 1,                  buffer_offset_ptr_and_seek( rawTxData, MAX_FIELD_LEN/2 - 1)) ); 
-            BAIL_IF( add_new_field(fields, XYM_STR_TXN_HARVESTING_2, STI_HEX_MESSAGE, MAX_FIELD_LEN/2 - 1,                  buffer_offset_ptr_and_seek( rawTxData, MAX_FIELD_LEN/2 - 1)) ); 
-            BAIL_IF( add_new_field(fields, XYM_STR_TXN_HARVESTING_3, STI_HEX_MESSAGE, txn->messageSize - MAX_FIELD_LEN + 2, buffer_offset_ptr_and_seek( rawTxData, txn->messageSize - MAX_FIELD_LEN + 2)) ); 
-        #endif
+            // Show persistent harvesting delegation message, split into pages by the formatter if needed
+            BAIL_IF( add_new_field(fields, XYM_STR_TXN_HARVESTING, STI_HEX_MESSAGE, txn->messageSize, buffer_offset_ptr_and_seek( rawTxData, txn->messageSize)) );
         }
         else 
         {
@@ -720,7 +729,7 @@ static int parse_mosaic_alias_txn_content( buffer_t* rawTxData, fields_array_t*
  *      maxFee //(only if not multisig)
  * }
  */
-static int parse_account_restriction_txn_content( buffer_t* rawTxData, uint8_t restrictionType, fields_array_t* fields )
+static int parse_account_restriction_txn_content( buffer_t* rawTxData, uint8_t restrictionType, uint8_t deletionType, fields_array_t* fields )
 {
     // get header
     const ar_header_t *txn = (const ar_header_t*) buffer_offset_ptr_and_seek( rawTxData, sizeof(ar_header_t)); // Read data and security check
@@ -749,7 +758,7 @@ static int parse_account_restriction_txn_content( buffer_t* rawTxData, uint8_t r
     }
     
     // Show address/mosaicId deletions count
-    BAIL_IF(add_new_field(fields, restrictionType, STI_UINT8_DELETION, sizeof(uint8_t), (const uint8_t*) &txn->restrictionDeletionsCount));
+    BAIL_IF(add_new_field(fields, deletionType, STI_UINT8_DELETION, sizeof(uint8_t), (const uint8_t*) &txn->restrictionDeletionsCount));
     
     // Show list of addition address
     for( uint8_t i = 0; i < txn->restrictionDeletionsCount; i++ )
@@ -787,17 +796,17 @@ static int parse_account_restriction_txn_content( buffer_t* rawTxData, uint8_t r
 
 static int parse_account_address_restriction_txn_content( buffer_t* rawTxData, fields_array_t* fields )
 {
-    return parse_account_restriction_txn_content(rawTxData, XYM_UINT8_AA_RESTRICTION, fields);
+    return parse_account_restriction_txn_content(rawTxData, XYM_UINT8_AA_RESTRICTION, XYM_UINT8_AA_RESTRICTION_DEL, fields);
 }
 
 static int parse_account_mosaic_restriction_txn_content( buffer_t* rawTxData, fields_array_t* fields )
 {
-    return parse_account_restriction_txn_content(rawTxData, XYM_UINT8_AM_RESTRICTION, fields);
+    return parse_account_restriction_txn_content(rawTxData, XYM_UINT8_AM_RESTRICTION, XYM_UINT8_AM_RESTRICTION_DEL, fields);
 }
 
 static int parse_account_operation_restriction_txn_content( buffer_t* rawTxData, fields_array_t* fields )
 {
-    return parse_account_restriction_txn_content(rawTxData, XYM_UINT8_AO_RESTRICTION, fields);
+    return parse_account_restriction_txn_content(rawTxData, XYM_UINT8_AO_RESTRICTION, XYM_UINT8_AO_RESTRICTION_DEL, fields);
 }
 
 
@@ -972,6 +981,12 @@ static int parse_inner_txn_content( buffer_t* rawTxData, uint32_t len, bool isCo
         if( !txn ) { return E_NOT_ENOUGH_DATA; }
 
         totalSize += txn->size;
+
+        // remember where the inner transaction starts, the review can jump to it
+        if( fields->innerCount < MAX_INNER_TX_COUNT )
+        {
+            fields->innerStart[fields->innerCount++] = fields->numFields;
+        }
         
         // Show Transaction type
         BAIL_IF(add_new_field(fields, isCosigning ? XYM_UINT16_TRANSACTION_DETAIL_TYPE : XYM_UINT16_INNER_TRANSACTION_TYPE, STI_UINT16, sizeof(uint16_t), (const uint8_t*) &txn->innerTxType));
@@ -1017,21 +1032,177 @@ static int parse_inner_txn_content( buffer_t* rawTxData, uint32_t len, bool isCo
 }
 
 
+/**
+ * Reads the next inner transfer of an aggregate and skips its padding.
+ * Returns E_TOO_MANY_FIELDS for other inner transactions, which can only be
+ * shown one by one.
+ */
+static int read_inner_transfer( buffer_t* rawTxData, const txn_header_t** transfer, const mosaic_t** mosaics )
+{
+    const inner_tx_header_t *header = (const inner_tx_header_t*) buffer_offset_ptr_and_seek( rawTxData, sizeof(inner_tx_header_t) );
+    if( !header ) { return E_NOT_ENOUGH_DATA; }
+    if( header->innerTxType != XYM_TXN_TRANSFER ) { return E_TOO_MANY_FIELDS; }
+
+    const txn_header_t *txn = (const txn_header_t*) buffer_offset_ptr_and_seek( rawTxData, sizeof(txn_header_t) );
+    if( !txn ) { return E_NOT_ENOUGH_DATA; }
+
+    *transfer = txn;
+    *mosaics  = (const mosaic_t*) buffer_offset_ptr( rawTxData );
+    if( !buffer_seek(rawTxData, txn->mosaicsCount * sizeof(mosaic_t) + txn->messageSize) ) { return E_INVALID_DATA; }
+
+    // fill zeros
+    if( !buffer_seek(rawTxData, header->size % ALIGNMENT_BYTES == 0 ? 0 : ALIGNMENT_BYTES - (header->size % ALIGNMENT_BYTES)) ) { return E_INVALID_DATA; }
+
+    return E_SUCCESS;
+}
+
+static int add_to_total( uint64_t* total, uint64_t amount )
+{
+    if( *total + amount < *total ) { return E_INVALID_DATA; }
+    *total += amount;
+    return E_SUCCESS;
+}
+
+/**
+ * Aggregate of transfers in summary mode, the totals are computed in one
+ * pass over the inner transfers and kept in 'fields->summary'.
+ * 
+ * 
+ * Output (fields)
+ * ----------------------------------
+ *      innerCount
+ *      recipientCount      ///< MAX_SUMMARY_RECIPIENTS + 1 when there are more, shown as "More than ..."
+ *      messageCount        ///< only if some transfers have a message
+ *      mosaic total        ///< for each mosaic
+ *      recipient, amount   ///< for each recipient, only if a single mosaic is sent to at most MAX_SUMMARY_RECIPIENTS recipients
+ */
+static int parse_transfer_summary( buffer_t* rawTxData, uint32_t len, fields_array_t* fields )
+{
+    aggregate_summary_t* summary = &fields->summary;
+    memset(summary, 0, sizeof(aggregate_summary_t));
+
+    const uint32_t end = rawTxData->offset + len;
+
+    while( rawTxData->offset < end )
+    {
+        const txn_header_t* txn;
+        const mosaic_t*     mosaics;
+        BAIL_IF( read_inner_transfer(rawTxData, &txn, &mosaics) );
+
+        // delegated harvesting messages are never hidden in a summary
+        if( txn->messageSize > 0 && *((const uint8_t*) &mosaics[txn->mosaicsCount]) == XYM_PERSISTENT_DELEGATED_HARVESTING ) { return E_TOO_MANY_FIELDS; }
+
+        summary->innerCount++;
+        if( txn->messageSize > 0 ) { summary->messageCount++; }
+
+        // total per mosaic
+        uint64_t sent = 0;
+        for( uint8_t i = 0; i < txn->mosaicsCount; i++ )
+        {
+            uint8_t m = 0;
+            while( m < summary->mosaicCount && summary->mosaics[m].mosaicId != mosaics[i].mosaicId ) { m++; }
+            if( m == summary->mosaicCount )
+            {
+                if( m == MAX_SUMMARY_MOSAICS ) { return E_TOO_MANY_FIELDS; }
+                summary->mosaics[m].mosaicId = mosaics[i].mosaicId;
+                summary->mosaicCount++;
+            }
+            BAIL_IF( add_to_total(&summary->mosaics[m].amount, mosaics[i].amount) );
+            BAIL_IF( add_to_total(&sent,                       mosaics[i].amount) );
+        }
+
+        // total per recipient, the first recipients are kept with their total. Past them
+        // the count stops, telling a new recipient apart would take a scan of the payload
+        if( summary->recipientCount > MAX_SUMMARY_RECIPIENTS ) { continue; }
+        uint8_t r = 0;
+        while( r < summary->recipientCount && memcmp(summary->recipients[r].address, txn->recipientAddress, XYM_ADDRESS_LENGTH) != 0 ) { r++; }
+        if( r < summary->recipientCount )
+        {
+            BAIL_IF( add_to_total(&summary->recipients[r].total.amount, sent) );
+        }
+        else if( r < MAX_SUMMARY_RECIPIENTS )
+        {
+            summary->recipients[r].address      = txn->recipientAddress;
+            summary->recipients[r].total.amount = sent;
+            summary->recipientCount++;
+        }
+        else
+        {
+            summary->recipientCount = MAX_SUMMARY_RECIPIENTS + 1;
+        }
+    }
+
+    BAIL_IF( add_new_field(fields, XYM_UINT32_AGG_INNER_COUNT,     STI_UINT32, sizeof(uint32_t), (const uint8_t*) &summary->innerCount) );
+    BAIL_IF( add_new_field(fields, XYM_UINT32_AGG_RECIPIENT_COUNT, STI_UINT32, sizeof(uint32_t), (const uint8_t*) &summary->recipientCount) );
+    if( summary->messageCount > 0 )
+    {
+        BAIL_IF( add_new_field(fields, XYM_UINT32_AGG_MESSAGE_COUNT, STI_UINT32, sizeof(uint32_t), (const uint8_t*) &summary->messageCount) );
+    }
+
+    const uint64_t mosaic_net_id = (fields->isMainnet ? XYM_MAINNET_MOSAIC_ID : XYM_TESTNET_MOSAIC_ID);
+
+    for( uint8_t m = 0; m < summary->mosaicCount; m++ )
+    {
+        if( summary->mosaics[m].mosaicId != mosaic_net_id )
+        {
+            BAIL_IF( add_new_field(fields, XYM_UNKNOWN_MOSAIC, STI_STR, 0, (const uint8_t*) &summary->mosaics[m]) ); // Unknow mosaic notification
+        }
+        BAIL_IF( add_new_field(fields, XYM_MOSAIC_TOTAL, mosaic_data_type(&summary->mosaics[m], fields), sizeof(mosaic_t), (const uint8_t*) &summary->mosaics[m]) );
+    }
+
+    // per recipient drill-down, amounts of different mosaics cannot be added up
+    // and the fee must still fit after it
+    uint32_t drillDownFields = 0;
+    for( uint8_t r = 0; r < summary->recipientCount && r < MAX_SUMMARY_RECIPIENTS; r++ )
+    {
+        const uint8_t networkType = summary->recipients[r].address[0];
+        drillDownFields += (networkType == MAINNET_NETWORK_TYPE || networkType == TESTNET_NETWORK_TYPE) ? 2 : 3;
+    }
+
+    if( summary->mosaicCount == 1 && summary->recipientCount <= MAX_SUMMARY_RECIPIENTS && fields->numFields + drillDownFields < MAX_FIELD_COUNT )
+    {
+        for( uint8_t r = 0; r < summary->recipientCount; r++ )
+        {
+            summary->recipients[r].total.mosaicId = summary->mosaics[0].mosaicId;
+            BAIL_IF( add_recipient_fields(fields, summary->recipients[r].address) );
+            BAIL_IF( add_new_field(fields, XYM_MOSAIC_AMOUNT, mosaic_data_type(&summary->mosaics[0], fields), sizeof(mosaic_t), (const uint8_t*) &summary->recipients[r].total) );
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+
 static int parse_aggregate_txn_content( buffer_t* rawTxData, fields_array_t* fields )
 {
     // get aggregate header
     const aggregate_txn_t *txn = (const aggregate_txn_t*) buffer_offset_ptr_and_seek(rawTxData, sizeof(aggregate_txn_t));
     if( !txn ) { return E_NOT_ENOUGH_DATA; }
 
-    bool isCosigning = (transactionContext.rawTxLength == XYM_TRANSACTION_HASH_LENGTH);
+    bool isCosigning = (fields->signLength == XYM_TRANSACTION_HASH_LENGTH);
     const uint8_t* p_tx_hash = isCosigning ? rawTxData->ptr : txn->transactionHash;
     
     // add fields
     BAIL_IF( add_new_field(fields, XYM_HASH256_AGG_HASH, STI_HASH256, XYM_TRANSACTION_HASH_LENGTH, p_tx_hash) ); // add transaction hash
     if( !buffer_can_read(rawTxData, txn->payloadSize) ) { return E_INVALID_DATA; }
-    BAIL_IF( parse_inner_txn_content(rawTxData, txn->payloadSize, isCosigning, fields) );
 
-    return E_SUCCESS;
+    // inner transactions are shown one by one, or summarised if they do not fit
+    const buffer_t payload   = *rawTxData;
+    const uint8_t  numFields = fields->numFields;
+
+    int status = parse_inner_txn_content(rawTxData, txn->payloadSize, isCosigning, fields);
+    if( status == E_TOO_MANY_FIELDS )
+    {
+        // drop everything the inner transactions wrote before starting over
+        memset(&fields->arr[numFields], 0, (fields->numFields - numFields) * sizeof(field_t));
+        memset(fields->innerStart, 0, sizeof(fields->innerStart));
+        *rawTxData         = payload;
+        fields->numFields  = numFields;
+        fields->innerCount = 0;
+        status = parse_transfer_summary(rawTxData, txn->payloadSize, fields);
+    }
+
+    return status;
 }
 
 
@@ -1039,7 +1210,8 @@ static int parse_aggregate_txn_content( buffer_t* rawTxData, fields_array_t* fie
 static int parse_txn_detail( buffer_t *rawTxData, const common_header_t *txn, fields_array_t* fields )
 {
     int result;
-    fields->numFields = 0;
+    fields->numFields  = 0;
+    fields->innerCount = 0;
 
     // Show Transaction type
     BAIL_IF( add_new_field(fields, XYM_UINT16_TRANSACTION_TYPE, STI_UINT16, sizeof(uint16_t), (const uint8_t*) &txn->transactionType) );
@@ -1077,7 +1249,7 @@ static int parse_txn_detail( buffer_t *rawTxData, const common_header_t *txn, fi
     return result;
 }
 
-static void set_sign_data_length( const buffer_t* rawTxdata, uint16_t transactionType ) //TODO: dont change global transactionContext here!!
+static uint32_t sign_data_length( const buffer_t* rawTxdata, uint16_t transactionType, bool isMainnet )
 {
     if( (transactionType == XYM_TXN_AGGREGATE_COMPLETE) || (transactionType == XYM_TXN_AGGREGATE_BONDED) )
     {
@@ -1091,32 +1263,132 @@ static void set_sign_data_length( const buffer_t* rawTxdata, uint16_t transactio
                                                           0x04, 0xCD, 0x45, 0x8E, 0x0A, 0xA2, 0xD9, 0xF1,
                                                           0xD5, 0xF3, 0x1A, 0x40, 0x20, 0x72, 0xB2, 0xD6 };
 
-        const bool           is_using_mainnet = (transactionContext.bip32Path[1] & 0x7FFFFFFF) == 4343; // checks if the coin_type field of bip32 path is 'symbol'
-        const unsigned char* net_hash         = is_using_mainnet ? MAINNET_GENERATION_HASH : TESTNET_GENERATION_HASH;
-        const bool           hashes_equal     = memcmp(net_hash, rawTxdata->ptr, XYM_TRANSACTION_HASH_LENGTH) == 0;
+        const unsigned char* net_hash     = isMainnet ? MAINNET_GENERATION_HASH : TESTNET_GENERATION_HASH;
+        const bool           hashes_equal = memcmp(net_hash, rawTxdata->ptr, XYM_TRANSACTION_HASH_LENGTH) == 0;
 
         if( hashes_equal )
         {
             // Sign data from generation hash to transaction hash
             // XYM_AGGREGATE_SIGNING_LENGTH = XYM_TRANSACTION_HASH_LENGTH
             //                                + sizeof(common_header_t) + sizeof(txn_fee_t) = 84
-            transactionContext.rawTxLength = XYM_AGGREGATE_SIGNING_LENGTH;
+            return XYM_AGGREGATE_SIGNING_LENGTH;
         }
         else 
         {
             // Sign transaction hash only (multisig cosigning transaction)
-            transactionContext.rawTxLength = XYM_TRANSACTION_HASH_LENGTH;
+            return XYM_TRANSACTION_HASH_LENGTH;
         }
     }
-    else 
+
+    // Sign all data in the transaction
+    return rawTxdata->size;
+}
+
+
+static bool is_supported_txn_type( uint16_t transactionType )
+{
+    switch( transactionType )
     {
-        // Sign all data in the transaction
-        transactionContext.rawTxLength = rawTxdata->size;
+        case XYM_TXN_TRANSFER:
+        case XYM_TXN_AGGREGATE_COMPLETE:
+        case XYM_TXN_AGGREGATE_BONDED:
+        case XYM_TXN_MODIFY_MULTISIG_ACCOUNT:
+        case XYM_TXN_REGISTER_NAMESPACE:
+        case XYM_TXN_ADDRESS_ALIAS:
+        case XYM_TXN_MOSAIC_ALIAS:
+        case XYM_TXN_ACCOUNT_ADDRESS_RESTRICTION:
+        case XYM_TXN_ACCOUNT_MOSAIC_RESTRICTION:
+        case XYM_TXN_ACCOUNT_OPERATION_RESTRICTION:
+        case XYM_TXN_ACCOUNT_KEY_LINK:
+        case XYM_TXN_NODE_KEY_LINK:
+        case XYM_TXN_VRF_KEY_LINK:
+        case XYM_TXN_VOTING_KEY_LINK:
+        case XYM_TXN_MOSAIC_DEFINITION:
+        case XYM_TXN_MOSAIC_SUPPLY_CHANGE:
+        case XYM_TXN_FUND_LOCK:
+            return true;
+        default:
+            return false;
+    }
+}
+
+int check_txn_header( const buffer_t* firstChunk, bool isMainnet, uint32_t maxLength )
+{
+    buffer_t chunk = *firstChunk;
+
+    // get common header and fee
+    const common_header_t* txnHeader = (const common_header_t*) buffer_offset_ptr_and_seek( &chunk, sizeof(common_header_t) );
+    if( !txnHeader ) { return E_SUCCESS; }
+
+    if( !is_supported_txn_type(txnHeader->transactionType) ) { return E_INVALID_DATA; }
+
+    const uint8_t networkType = (isMainnet ? MAINNET_NETWORK_TYPE : TESTNET_NETWORK_TYPE);
+    if( txnHeader->networkType != networkType ) { return E_INVALID_DATA; }
+
+    if( !buffer_seek(&chunk, sizeof(txn_fee_t)) ) { return E_SUCCESS; }
+
+    // size and least number of fields declared by the transaction header
+    uint32_t length    = sizeof(common_header_t) + sizeof(txn_fee_t);
+    uint32_t numFields = 2; // transaction type and fee
+
+    switch( txnHeader->transactionType )
+    {
+        case XYM_TXN_AGGREGATE_COMPLETE:
+        case XYM_TXN_AGGREGATE_BONDED:
+        {
+            const aggregate_txn_t* txn = (const aggregate_txn_t*) buffer_offset_ptr( &chunk );
+            if( !buffer_can_read(&chunk, sizeof(aggregate_txn_t)) ) { return E_SUCCESS; }
+
+            length    += sizeof(aggregate_txn_t) + txn->payloadSize;
+            numFields += 1; // transaction hash
+            break;
+        }
+        case XYM_TXN_TRANSFER:
+        {
+            const txn_header_t* txn = (const txn_header_t*) buffer_offset_ptr( &chunk );
+            if( !buffer_can_read(&chunk, sizeof(txn_header_t)) ) { return E_SUCCESS; }
+
+            length    += sizeof(txn_header_t) + txn->mosaicsCount * sizeof(mosaic_t) + txn->messageSize;
+            numFields += 2 + txn->mosaicsCount + (txn->mosaicsCount > 1 ? 1 : 0); // recipient, mosaics (and their count) and message
+            break;
+        }
+        case XYM_TXN_MODIFY_MULTISIG_ACCOUNT:
+        {
+            const multisig_account_t* txn = (const multisig_account_t*) buffer_offset_ptr( &chunk );
+            if( !buffer_can_read(&chunk, sizeof(multisig_account_t)) ) { return E_SUCCESS; }
+
+            const uint32_t count = txn->addressAdditionsCount + txn->addressDeletionsCount;
+            length    += sizeof(multisig_account_t) + count * XYM_ADDRESS_LENGTH;
+            numFields += 4 + count; // addresses, their counts and both deltas
+            break;
+        }
+        case XYM_TXN_ACCOUNT_ADDRESS_RESTRICTION:
+        case XYM_TXN_ACCOUNT_MOSAIC_RESTRICTION:
+        case XYM_TXN_ACCOUNT_OPERATION_RESTRICTION:
+        {
+            const ar_header_t* txn = (const ar_header_t*) buffer_offset_ptr( &chunk );
+            if( !buffer_can_read(&chunk, sizeof(ar_header_t)) ) { return E_SUCCESS; }
+
+            const uint32_t count       = txn->restrictionAdditionsCount + txn->restrictionDeletionsCount;
+            const uint32_t elementSize = (txnHeader->transactionType == XYM_TXN_ACCOUNT_ADDRESS_RESTRICTION) ? XYM_ADDRESS_LENGTH :
+                                         (txnHeader->transactionType == XYM_TXN_ACCOUNT_MOSAIC_RESTRICTION)  ? sizeof(uint64_t)   :
+                                                                                                               sizeof(uint16_t);
+            length    += sizeof(ar_header_t) + count * elementSize;
+            numFields += 4 + count; // restrictions, their counts, operation and type
+            break;
+        }
+        default:
+            break;
     }
+
+    if( length    > maxLength       ) { return E_DATA_TOO_LARGE;  }
+    if( numFields > MAX_FIELD_COUNT ) { return E_TOO_MANY_FIELDS; }
+
+    return E_SUCCESS;
 }
 
 
-int parse_txn_context( buffer_t* rawTxdata, fields_array_t* fields )
+int parse_txn_context( buffer_t* rawTxdata, bool isMainnet, fields_array_t* fields )
 {
     // get common header
     const common_header_t* txnHeader = (const common_header_t*) buffer_offset_ptr( rawTxdata );
@@ -1125,6 +1397,7 @@ int parse_txn_context( buffer_t* rawTxdata, fields_array_t* fields )
     const bool succ = buffer_seek( rawTxdata, sizeof(common_header_t) );
     if( !succ ) { return E_NOT_ENOUGH_DATA; }
 
-    set_sign_data_length( rawTxdata, txnHeader->transactionType );
+    fields->isMainnet  = isMainnet;
+    fields->signLength = sign_data_length( rawTxdata, txnHeader->transactionType, isMainnet );
     return parse_txn_detail( rawTxdata, txnHeader, fields );
 }
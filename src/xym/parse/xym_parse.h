@@ -38,10 +38,35 @@ typedef struct {
 
 #pragma pack(pop)
 
+typedef struct
+{
+    const uint8_t* address;   ///< recipient address in the raw transaction
+    mosaic_t       total;     ///< sum of the amounts sent to that recipient
+} recipient_total_t;
+
+/**
+ * Totals of an aggregate of transfers that is shown in summary mode,
+ * the summary fields point into it.
+ */
+typedef struct
+{
+    uint32_t          innerCount;                              ///< number of inner transfers
+    uint32_t          recipientCount;                          ///< number of distinct recipients, MAX_SUMMARY_RECIPIENTS + 1 for more
+    uint32_t          messageCount;                            ///< number of inner transfers with a message
+    uint8_t           mosaicCount;                             ///< number of distinct mosaics
+    mosaic_t          mosaics[MAX_SUMMARY_MOSAICS];            ///< total sent per mosaic
+    recipient_total_t recipients[MAX_SUMMARY_RECIPIENTS];      ///< total sent per recipient, first recipients only
+} aggregate_summary_t;
+
 typedef struct 
 {
     uint8_t numFields;
     field_t arr[MAX_FIELD_COUNT];
+    uint8_t innerCount;                         ///< number of inner transactions shown one by one
+    uint8_t innerStart[MAX_INNER_TX_COUNT];     ///< index of the first field (the type) of each of them
+    aggregate_summary_t summary;
+    bool     isMainnet;                         ///< network the transaction is shown for
+    uint32_t signLength;                        ///< bytes at the start of the raw transaction that are signed
 } fields_array_t;
 
 
@@ -53,10 +78,38 @@ typedef struct
  * The symbol serializations are defined here:
  * https://docs.symbolplatform.com/serialization/index.html
  * 
+ * An aggregate of transfers that has too many fields to be shown one by one
+ * is shown as a summary instead: the number of inner transfers, recipients
+ * and messages, the total of every mosaic and, when a single mosaic is sent
+ * to few enough recipients, the total received by each of them.
+ * 
+ * Aggregates are signed from the generation hash of the network to the
+ * transaction hash; one that does not start with that generation hash is the
+ * hash of an aggregate to cosign. Everything else is signed as a whole, see
+ * 'signLength'.
+ * 
  * @param[in]  rawTxdata  A buffer with the raw tx serialized data
+ * @param[in]  isMainnet  true if the transaction is signed with a mainnet path
  * @param[out] fields     An array with the individual transaction fields  
  * @return                one of the codes in the '_parser_error' enum
  */
-int parse_txn_context( buffer_t* rawTxdata, fields_array_t* fields );
+int parse_txn_context( buffer_t* rawTxdata, bool isMainnet, fields_array_t* fields );
+
+
+/**
+ * Checks what the first chunk of a transaction already tells, so that an
+ * unsupported transaction is rejected before the host uploads the rest:
+ * the transaction type, the network type, the size declared by the header
+ * (aggregate payload, transfer mosaics and message, multisig and restriction
+ * lists) and the least number of fields these would be shown with.
+ * 
+ * Parts of the header that are not in the chunk are not checked.
+ * 
+ * @param[in] firstChunk  A buffer with the transaction data of the first packet
+ * @param[in] isMainnet   true if the transaction is signed with a mainnet path
+ * @param[in] maxLength   the largest transaction that can be stored
+ * @return                one of the codes in the '_parser_error' enum
+ */
+int check_txn_header( const buffer_t* firstChunk, bool isMainnet, uint32_t maxLength );
 
 #endif //LEDGER_APP_XYM_XYMPARSE_H
@@ -16,12 +16,9 @@
 ********************************************************************************/
 #include "base32.h"
 #include "xym_helpers.h"
+#include <stdio.h>
 #include <string.h>
 
-#ifdef FUZZ
-#include <bsd/string.h>
-#endif // FUZZ
-
 void xym_print_amount(uint64_t amount, uint8_t divisibility, const char *asset, char *out, size_t outlen) {
     char buffer[AMOUNT_MAX_SIZE];
     uint64_t dVal = amount;
@@ -48,11 +45,9 @@ void xym_print_amount(uint64_t amount, uint8_t divisibility, const char *asset,
             }
         }
         if (i >= AMOUNT_MAX_SIZE - 1) {
-#ifdef FUZZ
+            // cannot happen, AMOUNT_MAX_SIZE fits the largest amount
+            out[0] = '\0';
             return;
-#else
-            THROW(0x6700);
-#endif
         }
     }
     // reverse order
@@ -73,50 +68,10 @@ void xym_print_amount(uint64_t amount, uint8_t divisibility, const char *asset,
 
     if (asset && strlen(asset)>0) {
         out[j++] = ' ';
-        strlcpy(out + j, asset, outlen - j);
+        snprintf(out + j, outlen - j, "%s", asset);
         out[j+strlen(asset)] = '\0';
     } else {
         out[j] = '\0';
     }
 }
 
-#ifndef FUZZ
-void sha_calculation(uint8_t *in, uint8_t inlen, uint8_t *out, uint8_t outlen) {
-    cx_sha3_t hash;
-    cx_sha3_init(&hash, 256);
-    cx_hash(&hash.header, CX_LAST, in, inlen, out, outlen);
-}
-
-void ripemd(uint8_t *in, uint8_t inlen, uint8_t *out, uint8_t outlen) {
-    cx_ripemd160_t hash;
-    cx_ripemd160_init(&hash);
-    cx_hash(&hash.header, CX_LAST, in, inlen, out, outlen);
-}
-
-void xym_public_key_and_address( cx_ecfp_public_key_t *inPublicKey, uint8_t inNetworkId, uint8_t *outPublicKey, char *outAddress, uint8_t outLen ) 
-{
-     // TODO: use defines instead hardcoded numbers
-
-    uint8_t buffer1[32];
-    uint8_t buffer2[20];
-    uint8_t rawAddress[32];
-
-    for (uint8_t i=0; i<32; i++) {
-        outPublicKey[i] = inPublicKey->W[64 - i];
-    }
-    if ((inPublicKey->W[32] & 1) != 0) {
-        outPublicKey[31] |= 0x80;
-    }
-    sha_calculation(outPublicKey, 32, buffer1, sizeof(buffer1));
-    ripemd(buffer1, 32, buffer2, sizeof(buffer2));
-    //step1: add network prefix char
-    rawAddress[0] = inNetworkId;
-    //step2: add ripemd160 hash
-    memcpy(rawAddress + 1, buffer2, sizeof(buffer2));
-    sha_calculation(rawAddress, 21, buffer1, sizeof(buffer1));
-    //step3: add checksum
-    memcpy(rawAddress + 21, buffer1, 3);
-    rawAddress[24] = 0;
-    base32_encode((const uint8_t *)rawAddress, 24, (char *) outAddress, outLen);
-}
-#endif
@@ -17,12 +17,7 @@
 #ifndef LEDGER_APP_XYM_XYMHELPERS_H
 #define LEDGER_APP_XYM_XYMHELPERS_H
 
-#ifndef FUZZ
-#include <os.h>
-#include <cx.h>
-#include <os_io_seproxyhal.h>
-#endif // FUZZ
-
+#include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
 
@@ -56,8 +51,8 @@
 
 #define XYM_MAINNET_MOSAIC_ID 0x6BED913FA20223F8
 #define XYM_TESTNET_MOSAIC_ID 0x72C0212E67A08BCE
-/* max amount is max int64 scaled down: "922337203685.4775807" */
-#define AMOUNT_MAX_SIZE 21
+/* max amount is max uint64 scaled down: "18446744073709.551615" */
+#define AMOUNT_MAX_SIZE 22
 #define XYM_ADDRESS_LENGTH 24
 #define XYM_PRETTY_ADDRESS_LENGTH 39
 #define XYM_PUBLIC_KEY_LENGTH 32
@@ -67,8 +62,5 @@
 #define XYM_AGGREGATE_SIGNING_LENGTH 84
 
 void xym_print_amount(uint64_t amount, uint8_t divisibility, const char *asset, char *out, size_t outlen);
-#ifndef FUZZ
-void xym_public_key_and_address(cx_ecfp_public_key_t *inPublicKey, uint8_t inNetworkId, uint8_t *outPublicKey, char *outAddress, uint8_t outLen);
-#endif
 
 #endif //LEDGER_APP_XYM_XYMHELPERS_H
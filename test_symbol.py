@@ -40,7 +40,7 @@ print("publicKey respond       [" + str(publicKeyLen) + "] " + publicKey[1:publi
 transferTx = "E004008090058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC11550198544180841E0000000000F6A98B390600000098F2A5E8E063AD1A9085EF5B5167E2F1A5645C48FA2C024917000100000000003CE19A057E831F0940A5AE0200000000005468697320697320612074657374206D657373616765"
 transferTxNotXYM = "E004008090058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC11550198544180841E0000000000F6A98B390600000098F2A5E8E063AD1A9085EF5B5167E2F1A5645C48FA2C024917000100000000001AB2C5CA0D99625E40A5AE0200000000005468697320697320612074657374206D657373616765"
 
-createMosaic1 = "E0048081FF058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC11550198414180841E0000000000F9BD913906000000E5F37FE3F83F4F0A2F21E7CF25F75CF29A20D7929CBEB7EB552EDA846969281F9000000000000000460000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C400000000001984D4171243F1123B82C530A00000000000000EADF0D4407000000410000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C400000000001984D4271243F1123B82C5340420F0000000000010000000000"
+createMosaic1 = "E0048081FF058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC11550198414180841E0000000000F9BD91390600000055CC608962017693E47D0FE6270A00E4AC0ABBE51E23A2B68786C10CFCB32FE69000000000000000460000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C400000000001984D4171243F1123B82C530A00000000000000EADF0D4407000000410000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C400000000001984D4271243F1123B82C5340420F0000000000010000000000"
 createMosaic2 = "E0040180020000"
 
 createNamespace = "E00400806C058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC115501984E4180841E0000000000128838C40600000000A3020000000000C880D8EBBA4A85A90011666F6F35373673676E6C78646E66626478"
@@ -59,21 +59,21 @@ accountOperationRestriction = "E004008053058000002C80000001800000008000000080000
 accountMultisig = "E0040080D9058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC11550198414280841E000000000077769F5906000000043D6F6E851CAE4ED2B975AEEF61DFDF00B85BBB2503AC23DD7586E3C0B079566800000000000000680000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C40000000000198554101010200000000009817259A942F6AE0EA32B01E368687405536E61125ECF701984B730EA3B726CC12A9FAF78B4D37354FF8722DBB950137"
 hashLockAccountMultisig = "E004008081058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC11550198484180841E0000000000D58B993906000000A84582052890A9518096980000000000E0010000000000002B51EBCBC3E40EFE8AF68A0408F5A72474B1327A64E3E3B47D9B139230C7833B"
 
-multisigTransaferTx = "E0040080E1058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC1155019841422076000000000000E73BE96B060000004941C270B56778E01629FC82EDDC622668F076CE1583AFCCA3F6DE7FE03615BB70000000000000006D000000000000007299D0308AA442C6EB7885B74BD7049A8B2236E6A3E0CC6FDD4036F543A3C6E40000000001985441985507CA7F3D1C9069E16E1A0FCE7C5AD4607421ED31E6730D000100000000003CE19A057E831F0980969800000000000054657374206D657373616765000000"
+multisigTransaferTx = "E0040080E1058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC1155019841422076000000000000E73BE96B06000000B4D450F1B5D6BA62858293C6F22E2C08A387E37446D5AC953EEB325CC7B43A6E70000000000000006D000000000000007299D0308AA442C6EB7885B74BD7049A8B2236E6A3E0CC6FDD4036F543A3C6E40000000001985441985507CA7F3D1C9069E16E1A0FCE7C5AD4607421ED31E6730D000100000000003CE19A057E831F0980969800000000000054657374206D657373616765000000"
 
-multisigCreateMosaic1 = "E0048081FF058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC115501984142A0830000000000007C0FED6B06000000705B456E99A2FA7DA3D4F02ABB1993774426B8095705C2116E6FB59E95A2587D900000000000000046000000000000007299D0308AA442C6EB7885B74BD7049A8B2236E6A3E0CC6FDD4036F543A3C6E40000000001984D41645AC697472FCA780000000000000000E65EF6F70300000041000000000000007299D0308AA442C6EB7885B74BD7049A8B2236E6A3E0CC6FDD4036F543A3C6E40000000001984D42645AC697472FCA780065CD1D00000000010000000000"
+multisigCreateMosaic1 = "E0048081FF058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC115501984142A0830000000000007C0FED6B06000000E780E331021E97F547938DA0144C833403D95040E0B74D8C47F6D0D3AEC97C08900000000000000046000000000000007299D0308AA442C6EB7885B74BD7049A8B2236E6A3E0CC6FDD4036F543A3C6E40000000001984D41645AC697472FCA780000000000000000E65EF6F70300000041000000000000007299D0308AA442C6EB7885B74BD7049A8B2236E6A3E0CC6FDD4036F543A3C6E40000000001984D42645AC697472FCA780065CD1D00000000010000000000"
 multisigCreateMosaic2 = "E0040180020000"
 
-multisigCreateNamespace = "E0040080C1058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC115501984142A0680000000000006A87F06B06000000B96E1C08F8434BFDC4D1F292EB3F911B1A3C5B3EE102887A8ACDD75A79A4BB6250000000000000004A000000000000007299D0308AA442C6EB7885B74BD7049A8B2236E6A3E0CC6FDD4036F543A3C6E40000000001984E4100A30200000000004F870552748FEBB000086D756C7469736967000000000000"
+multisigCreateNamespace = "E0040080C1058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC115501984142A0680000000000006A87F06B060000007C838133F5E2B018B4515DB7BFE93471340449989FBCE5237237CA831EB61EBA50000000000000004A000000000000007299D0308AA442C6EB7885B74BD7049A8B2236E6A3E0CC6FDD4036F543A3C6E40000000001984E4100A30200000000004F870552748FEBB000086D756C7469736967000000000000"
 hashLockMultisigCreateNamespace = "E004008081058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC115501984841A04D00000000000052C3F06B060000003CE19A057E831F098096980000000000E803000000000000E019A4A92002505B8B5029AE556958ADCDFBEDAC26C2F79DE1668C5BC588EDF7"
 multisigCreateSubNamespace = "E004008071058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC115501984E41E0460000000000005632F36B060000001409CC7609AC4FD6952019898F84F5A401167375625F6E616D6573706163655F6D756C7469736967"
-multisigTransaferCosignatureTx = "E0040080D9058000002C800000018000000080000000800000000EFE6E4A881D312984767CABBE53DAC00419E179932A5C784B51132FBE5F7C880198414200530700000000008949E54608000000A84E5976D0D9DC79D07A3FFCB7D9EBD34C46C39058C243DF963400D9FEAFFD5368000000000000006400000000000000A1855B7D18FC1EE2AB5BB01098ACA8C0B8B6B3FA8819309066795E064E79B625000000000198544198F2A5E8E063AD1A9085EF5B5167E2F1A5645C48FA2C024904000100000000003CE19A057E831F0980969800000000000053445600000000"
+multisigTransaferCosignatureTx = "E0040080D9058000002C800000018000000080000000800000000EFE6E4A881D312984767CABBE53DAC00419E179932A5C784B51132FBE5F7C880198414200530700000000008949E54608000000BBB27B5897DCD39633C8CECAE802BDD9596066C84B74D1D08E96A34ADF2C5F9F68000000000000006400000000000000A1855B7D18FC1EE2AB5BB01098ACA8C0B8B6B3FA8819309066795E064E79B625000000000198544198F2A5E8E063AD1A9085EF5B5167E2F1A5645C48FA2C024904000100000000003CE19A057E831F0980969800000000000053445600000000"
 
-accountMetadataTx = "E0040080F1058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC1155019841414084040000000000CFEA4287070000005F221AD2C6D297E683692CE332B24157057E6FB43A832F18C13495EC49544E0880000000000000007F0000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C40000000000198444198F2A5E8E063AD1A9085EF5B5167E2F1A5645C48FA2C02497AEAFC0DA38583AB2B002B0074686973206973207468652076616C7565206669656C64206F66206163636F756E74206D6574616461746100"
-mosaicMetadataTx = "E0040080F9058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC11550198414180A3040000000000320B4D8707000000FD62E4D107693B6B0A7D862F2BBE49695565764AE41AE0D0344C47AE82DCB00C8800000000000000830000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C40000000000198444298F2A5E8E063AD1A9085EF5B5167E2F1A5645C48FA2C02499FFAB5EF750B0CD096C5210420F5326E270027005468697320697320746865206D6F73616963206D657461646174612076616C7565206669656C640000000000"
-namespaceMetadataTx = "E0040080F1058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC1155019841414084040000000000AFBB538707000000668FE1351AC31C35536EE3A368F2C2310DD3D7E67A8345050548AE8B6596015D80000000000000007A0000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C40000000000198444398F2A5E8E063AD1A9085EF5B5167E2F1A5645C48FA2C02496D9D7CA7FA8F829ED62A3CC68F5247851E001E004E616D657370616365206D657461646174612076616C7565206669656C64000000000000"
+accountMetadataTx = "E0040080F1058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC1155019841414084040000000000CFEA428707000000E4963AA615405563C45D2862EFC48FC144C1E1456476DABC28D7C33C1831272580000000000000007F0000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C40000000000198444198F2A5E8E063AD1A9085EF5B5167E2F1A5645C48FA2C02497AEAFC0DA38583AB2B002B0074686973206973207468652076616C7565206669656C64206F66206163636F756E74206D6574616461746100"
+mosaicMetadataTx = "E0040080F9058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC11550198414180A3040000000000320B4D87070000006A12D1AB3B22C9EF63845475BA9FE88B1FF1BE065E6CF411DFCB50040DBA93AB8800000000000000830000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C40000000000198444298F2A5E8E063AD1A9085EF5B5167E2F1A5645C48FA2C02499FFAB5EF750B0CD096C5210420F5326E270027005468697320697320746865206D6F73616963206D657461646174612076616C7565206669656C640000000000"
+namespaceMetadataTx = "E0040080F1058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC1155019841414084040000000000AFBB538707000000287974087EEDA2C4A867282F7945ABE3B243FC051852D101BF0CD47E75C9B4EC80000000000000007A0000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C40000000000198444398F2A5E8E063AD1A9085EF5B5167E2F1A5645C48FA2C02496D9D7CA7FA8F829ED62A3CC68F5247851E001E004E616D657370616365206D657461646174612076616C7565206669656C64000000000000"
 
-startDelegatedHarvestingTransaction1 = "E0048081FF058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC115501984141C0A8000000000000C237012C080000000C8666CEF61F61B78515149A1414455C77A0CCD7C9AD5F39DFE46761AB6556DF0801000000000000510000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C400000000001984C4100278C080D6B149902E1576723DA6362065D3A134BEE6383827353540492B9110100000000000000510000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C400000000001984342C1A714313258"
+startDelegatedHarvestingTransaction1 = "E0048081FF058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC115501984141C0A8000000000000C237012C080000003ADB76E58E719F4BB7491046E61C0D2CFE694B0DB39C9747449BC036ECB8548D0801000000000000510000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C400000000001984C4100278C080D6B149902E1576723DA6362065D3A134BEE6383827353540492B9110100000000000000510000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C400000000001984342C1A714313258"
 startDelegatedHarvestingTransaction2 = "E0040180F473D83894977C68C783A4EED7A3391EAFD704BF8500361EC321DB0100000000000000510000000000000017140D44583C4BAD44C0A9DB963E315E1C425A7495271738B8F81938DDE75C400000000001984C4281890592F960AAEBDA7612C8917FA9C267A845D78D74D4B3651AF093E67750010100000000000000"
 
 persistentHarvestingDelegationTransferTx = "E0040080ED058000002C800000018000000080000000800000003B5E1FA6445653C971A50687E75E6D09FB30481055E3990C84B25E9222DC115501985441A07404000000000090125640080000009863E0511468632BA77C8C8597266AE1A0DA8C9420C4F6238400000000000000FE2A8061577301E28AEC26D42EFCE832BE498BB8CFCC7687BC5BC6B22A82F4BA415A7DF13E1DEA994EAD70125CA250DD6CD8AEA8BAE26AD9A8FC9CB45A996E59BD8894E3D618043887E2383A6BB161A18AB58F406D7DFF384CBD6A669FD152E5AD84B372425212CAAECCB712674AA6C737894BB14FADFE93A3E3AF73A34187D49740891C"
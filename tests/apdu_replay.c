@@ -0,0 +1,636 @@
+/*******************************************************************************
+*   XYM Wallet
+*   (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+/**
+ * Native APDU server.
+ *
+ * Runs the real 'apdu_parser()' -> 'handle_apdu()' dispatch, parser,
+ * formatter and review flows on the host, against the SDK stand-in found in
+ * 'native/'. Review and address confirmation flows are answered
+ * automatically (approve by default), so whole signing sessions can be
+ * replayed at host speed.
+ *
+ * Usage:
+ *   apdu_replay --tcp <port>        serve length-prefixed APDUs over TCP
+ *   apdu_replay --unix <path>       serve length-prefixed APDUs over a Unix socket
+ *   apdu_replay --script <file>     replay a file of hex APDUs, one per line
+ *
+ * Script lines starting with '!' drive the device instead of sending an APDU:
+ *   !reset         the transport is reset, a new session starts with the next line
+ *   !tick <n>      n ticker events (100 ms each on the device)
+ * and a line '<= <hex>' is the expected response (data and status word) to
+ * the APDU before it. The replay exits with 1 if a response differs.
+ *
+ * Options:
+ *   --reject       reject every review instead of approving it
+ *   --repeat <n>   replay the script n times (script mode)
+ *   --quiet        do not print exchanged APDUs
+ *
+ * Socket framing: each command and each response is preceded by its length
+ * as a 4 bytes big endian integer. A response holds the response data
+ * followed by the status word.
+ *
+ * On exit (or when a client disconnects) the server prints APDUs/s, the time
+ * spent per instruction, and how much of it went into parsing, formatting
+ * and (placeholder) cryptography.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <native_sdk.h>
+
+#include "apdu/entry.h"
+#include "apdu/global.h"
+#include "apdu/messages/select_account.h"
+#include "apdu/messages/sign_transaction.h"
+#include "apdu/parser.h"
+#include "ui/main/idle_menu.h"
+#include "xym/format/format.h"
+#include "xym/parse/xym_parse.h"
+#include "types.h"
+#include "io.h"
+
+#define MAX_SCRIPT_LINE     2048
+#define MAX_USER_STEPS      1024
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t errors;
+    uint64_t totalNs;
+    uint64_t maxNs;
+} ins_stats_t;
+
+static ins_stats_t G_stats[256];
+static uint64_t    G_received_at = 0;
+static uint8_t     G_current_ins = 0;
+static bool        G_reject = false;
+static bool        G_quiet = false;
+
+// script mode
+static FILE*       G_script = NULL;
+static bool        G_script_reset = false;   ///< the session ended on a '!reset' line
+static uint8_t     G_last_response[IO_APDU_BUFFER_SIZE];
+static size_t      G_last_response_length = 0;
+static unsigned    G_script_line = 0;
+static unsigned    G_script_mismatches = 0;
+
+// socket mode
+static int         G_client = -1;
+
+
+/*******************************************************************************
+ * Profiling hooks, see '--wrap' in CMakeLists.txt
+ ******************************************************************************/
+
+int  __real_parse_txn_context( buffer_t* rawTxdata, bool isMainnet, fields_array_t* fields );
+void __real_format_field( const field_t* field, char* dst );
+void __real_resolve_fieldname( const field_t* field, char* dst );
+void __real_reset_transaction_context( void );
+
+int __wrap_parse_txn_context( buffer_t* rawTxdata, bool isMainnet, fields_array_t* fields )
+{
+    const uint64_t start = native_now_ns();
+    const int result = __real_parse_txn_context( rawTxdata, isMainnet, fields );
+    native_profile_add( NATIVE_PROFILE_PARSE, start );
+    return result;
+}
+
+void __wrap_format_field( const field_t* field, char* dst )
+{
+    const uint64_t start = native_now_ns();
+    __real_format_field( field, dst );
+    native_profile_add( NATIVE_PROFILE_FORMAT, start );
+}
+
+void __wrap_resolve_fieldname( const field_t* field, char* dst )
+{
+    const uint64_t start = native_now_ns();
+    __real_resolve_fieldname( field, dst );
+    native_profile_add( NATIVE_PROFILE_FORMAT, start );
+}
+
+// resets made by 'handle_error()' are not seen, the call does not leave global.c
+void __wrap_reset_transaction_context( void )
+{
+    const uint64_t start = native_now_ns();
+    __real_reset_transaction_context();
+    native_profile_add( NATIVE_PROFILE_RESET, start );
+}
+
+
+/*******************************************************************************
+ * Transport
+ ******************************************************************************/
+
+static void print_hex( const char* prefix, const uint8_t* data, size_t length )
+{
+    if( G_quiet )
+    {
+        return;
+    }
+
+    printf( "%s", prefix );
+    for( size_t i = 0; i < length; i++ )
+    {
+        printf( "%02X", data[i] );
+    }
+    printf( "\n" );
+}
+
+static void on_command_received( const uint8_t* command, size_t length )
+{
+    G_received_at = native_now_ns();
+    G_current_ins = (length > OFFSET_INS) ? command[OFFSET_INS] : 0;
+    G_stats[G_current_ins].count++;
+    print_hex( "=> ", command, length );
+}
+
+static void on_response_sent( const uint8_t* response, size_t length )
+{
+    const uint64_t elapsed = native_now_ns() - G_received_at;
+    ins_stats_t* stats = &G_stats[G_current_ins];
+
+    stats->totalNs += elapsed;
+    if( elapsed > stats->maxNs )
+    {
+        stats->maxNs = elapsed;
+    }
+    if( length < 2 || response[length - 2] != 0x90 || response[length - 1] != 0x00 )
+    {
+        stats->errors++;
+    }
+    print_hex( "<= ", response, length );
+}
+
+/**
+ * Answers the flow currently on screen: walks to the "Approve" (or "Reject")
+ * step, rendering every screen on the way, and presses both buttons.
+ */
+static void answer_user_interaction()
+{
+    const char* choice = G_reject ? "Reject" : "Approve";
+
+    for( int i = 0; i < MAX_USER_STEPS; i++ )
+    {
+        const ux_flow_step_t* step = native_ux_current_step();
+        if( step != NULL && step->validate != NULL && native_ux_step_has_text(step, choice) )
+        {
+            native_ux_press_both();
+            return;
+        }
+
+        if( !native_ux_press_right() )
+        {
+            break;
+        }
+    }
+
+    fprintf( stderr, "apdu_replay: no \"%s\" step found in the pending flow\n", choice );
+    THROW(EXCEPTION_IO_RESET);
+}
+
+static bool read_exact( int fd, uint8_t* data, size_t length )
+{
+    while( length > 0 )
+    {
+        const ssize_t n = read( fd, data, length );
+        if( n <= 0 )
+        {
+            if( n < 0 && errno == EINTR )
+            {
+                continue;
+            }
+            return false;
+        }
+        data   += n;
+        length -= (size_t) n;
+    }
+    return true;
+}
+
+static bool write_exact( int fd, const uint8_t* data, size_t length )
+{
+    while( length > 0 )
+    {
+        const ssize_t n = write( fd, data, length );
+        if( n <= 0 )
+        {
+            if( n < 0 && errno == EINTR )
+            {
+                continue;
+            }
+            return false;
+        }
+        data   += n;
+        length -= (size_t) n;
+    }
+    return true;
+}
+
+static int socket_receive( uint8_t* command, size_t size )
+{
+    uint8_t header[4];
+    if( !read_exact(G_client, header, sizeof(header)) )
+    {
+        return 0;
+    }
+
+    const uint32_t length = ((uint32_t) header[0] << 24) | ((uint32_t) header[1] << 16) |
+                            ((uint32_t) header[2] << 8)  |  (uint32_t) header[3];
+    if( length == 0 || length > size || !read_exact(G_client, command, length) )
+    {
+        return 0;
+    }
+
+    on_command_received( command, length );
+    return (int) length;
+}
+
+static bool socket_send( const uint8_t* response, size_t length )
+{
+    const uint8_t header[4] = { (uint8_t) (length >> 24), (uint8_t) (length >> 16),
+                                (uint8_t) (length >> 8),  (uint8_t) length };
+
+    on_response_sent( response, length );
+    return write_exact(G_client, header, sizeof(header)) && write_exact(G_client, response, length);
+}
+
+static int hex_value( char c )
+{
+    if( c >= '0' && c <= '9' ) return c - '0';
+    if( c >= 'a' && c <= 'f' ) return c - 'a' + 10;
+    if( c >= 'A' && c <= 'F' ) return c - 'A' + 10;
+    return -1;
+}
+
+// hex digits up to the end of the line or a '#', anything else is ignored
+static size_t parse_hex( const char* line, uint8_t* data, size_t size )
+{
+    size_t length = 0;
+    int high = -1;
+
+    for( const char* c = line; *c != '\0' && *c != '#'; c++ )
+    {
+        const int value = hex_value( *c );
+        if( value < 0 )
+        {
+            continue;
+        }
+        if( high < 0 )
+        {
+            high = value;
+        }
+        else if( length < size )
+        {
+            data[length++] = (uint8_t) ((high << 4) | value);
+            high = -1;
+        }
+    }
+    return length;
+}
+
+static int script_receive( uint8_t* command, size_t size )
+{
+    char line[MAX_SCRIPT_LINE];
+
+    while( fgets(line, sizeof(line), G_script) != NULL )
+    {
+        G_script_line++;
+        if( strncmp(line, "<=", 2) == 0 )
+        {
+            uint8_t expected[IO_APDU_BUFFER_SIZE];
+            const size_t length = parse_hex( line + 2, expected, sizeof(expected) );
+            if( length != G_last_response_length || memcmp(expected, G_last_response, length) != 0 )
+            {
+                fprintf( stderr, "apdu_replay: line %u: unexpected response\n", G_script_line );
+                G_script_mismatches++;
+            }
+            continue;
+        }
+
+        if( line[0] == '!' )
+        {
+            if( strncmp(line, "!reset", 6) == 0 )
+            {
+                G_script_reset = true;
+                return 0;
+            }
+            if( strncmp(line, "!tick", 5) == 0 )
+            {
+                for( int ticks = atoi(line + 5); ticks > 0; ticks-- )
+                {
+                    tick_upload_session();
+                }
+                continue;
+            }
+            fprintf( stderr, "apdu_replay: unknown directive %s", line );
+            continue;
+        }
+
+        const size_t length = parse_hex( line, command, size );
+        if( length > 0 )
+        {
+            on_command_received( command, length );
+            return (int) length;
+        }
+    }
+    return 0;
+}
+
+static bool script_send( const uint8_t* response, size_t length )
+{
+    G_last_response_length = MIN( length, sizeof(G_last_response) );
+    memcpy( G_last_response, response, G_last_response_length );
+    on_response_sent( response, length );
+    return true;
+}
+
+
+/*******************************************************************************
+ * App loop
+ ******************************************************************************/
+
+/**
+ * Same loop as 'xym_main()', a transport that goes away ends the session.
+ */
+static void run_session( const native_transport_t* transport )
+{
+    native_set_transport( transport );
+    suspend_transaction_context();
+    reset_account_slots();
+    io_init();
+    display_idle_menu();
+
+    BEGIN_TRY_L(session)
+    {
+        TRY_L(session)
+        {
+            while( true )
+            {
+                BEGIN_TRY
+                {
+                    TRY
+                    {
+                        const int size = io_receive_command();
+                        if( size < 0 )
+                        {
+                            handle_error( NO_APDU_RECEIVED );
+                            THROW(EXCEPTION_IO_RESET);
+                        }
+
+                        ApduCommand_t cmd;
+                        memset( &cmd, 0, sizeof(cmd) );
+
+                        if( !apdu_parser(G_io_apdu_buffer, size, &cmd) )
+                        {
+                            handle_error( WRONG_APDU_DATA_LENGTH );
+                        }
+                        else
+                        {
+                            handle_apdu( &cmd );
+                        }
+                    }
+                    CATCH(EXCEPTION_IO_RESET)
+                    {
+                        THROW(EXCEPTION_IO_RESET);
+                    }
+                    CATCH_OTHER(e)
+                    {
+                        handle_error( e );
+                    }
+                    FINALLY
+                    {
+                    }
+                }
+                END_TRY;
+            }
+        }
+        CATCH_L(session, EXCEPTION_IO_RESET)
+        {
+        }
+        FINALLY_L(session)
+        {
+        }
+    }
+    END_TRY_L(session);
+
+    native_set_transport( NULL );
+}
+
+static void print_statistics( uint64_t elapsedNs )
+{
+    uint32_t total = 0;
+    uint64_t busyNs = 0;
+    for( int ins = 0; ins < 256; ins++ )
+    {
+        total  += G_stats[ins].count;
+        busyNs += G_stats[ins].totalNs;
+    }
+
+    const double seconds = (double) elapsedNs / 1e9;
+    fprintf( stderr, "\n%u APDUs in %.3f s, %.1f APDUs/s\n", total, seconds, (seconds > 0) ? total / seconds : 0.0 );
+    fprintf( stderr, "%-6s %10s %8s %12s %12s\n", "INS", "count", "errors", "avg [us]", "max [us]" );
+    for( int ins = 0; ins < 256; ins++ )
+    {
+        const ins_stats_t* stats = &G_stats[ins];
+        if( stats->count == 0 )
+        {
+            continue;
+        }
+        fprintf( stderr, "0x%02X   %10u %8u %12.1f %12.1f\n", ins, stats->count, stats->errors,
+                 (double) stats->totalNs / stats->count / 1e3, (double) stats->maxNs / 1e3 );
+    }
+
+    const char* names[NATIVE_PROFILE_COUNT] = { "parse", "format", "crypto", "reset" };
+    for( int category = 0; category < NATIVE_PROFILE_COUNT; category++ )
+    {
+        fprintf( stderr, "%-8s %12.1f us  (%5.1f%% of APDU time)\n", names[category],
+                 (double) G_native_profile_ns[category] / 1e3,
+                 (busyNs > 0) ? 100.0 * (double) G_native_profile_ns[category] / (double) busyNs : 0.0 );
+    }
+    fprintf( stderr, "reset    %12.3f us per APDU\n", (total > 0) ? (double) G_native_profile_ns[NATIVE_PROFILE_RESET] / total / 1e3 : 0.0 );
+    fprintf( stderr, "screens  %12u\n", native_ux_screen_count() );
+}
+
+static int run_script( const char* path, int repeat )
+{
+    const native_transport_t transport = { script_send, script_receive, answer_user_interaction };
+    const uint64_t start = native_now_ns();
+
+    for( int i = 0; i < repeat; i++ )
+    {
+        G_script = fopen( path, "r" );
+        G_script_line = 0;
+        if( G_script == NULL )
+        {
+            fprintf( stderr, "apdu_replay: cannot open %s: %s\n", path, strerror(errno) );
+            return 1;
+        }
+        do
+        {
+            G_script_reset = false;
+            run_session( &transport );
+        } while( G_script_reset );
+        fclose( G_script );
+        G_script = NULL;
+    }
+
+    print_statistics( native_now_ns() - start );
+    if( G_script_mismatches > 0 )
+    {
+        fprintf( stderr, "apdu_replay: %u unexpected responses\n", G_script_mismatches );
+        return 1;
+    }
+    return 0;
+}
+
+static int run_server( int server )
+{
+    const native_transport_t transport = { socket_send, socket_receive, answer_user_interaction };
+
+    if( listen(server, 1) != 0 )
+    {
+        perror( "apdu_replay: listen" );
+        return 1;
+    }
+
+    while( true )
+    {
+        G_client = accept( server, NULL, NULL );
+        if( G_client < 0 )
+        {
+            if( errno == EINTR )
+            {
+                continue;
+            }
+            perror( "apdu_replay: accept" );
+            return 1;
+        }
+
+        memset( G_stats, 0, sizeof(G_stats) );
+        memset( G_native_profile_ns, 0, sizeof(G_native_profile_ns) );
+
+        const uint64_t start = native_now_ns();
+        run_session( &transport );
+        print_statistics( native_now_ns() - start );
+
+        close( G_client );
+        G_client = -1;
+    }
+}
+
+static int open_tcp_server( int port )
+{
+    const int server = socket( AF_INET, SOCK_STREAM, 0 );
+    const int enable = 1;
+    struct sockaddr_in address;
+
+    memset( &address, 0, sizeof(address) );
+    address.sin_family      = AF_INET;
+    address.sin_port        = htons( (uint16_t) port );
+    address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+
+    if( server < 0 ||
+        setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)) != 0 ||
+        bind(server, (const struct sockaddr*) &address, sizeof(address)) != 0 )
+    {
+        perror( "apdu_replay: tcp" );
+        return -1;
+    }
+    fprintf( stderr, "apdu_replay: listening on 127.0.0.1:%d\n", port );
+    return server;
+}
+
+static int open_unix_server( const char* path )
+{
+    const int server = socket( AF_UNIX, SOCK_STREAM, 0 );
+    struct sockaddr_un address;
+
+    memset( &address, 0, sizeof(address) );
+    address.sun_family = AF_UNIX;
+    strlcpy( address.sun_path, path, sizeof(address.sun_path) );
+    unlink( path );
+
+    if( server < 0 || bind(server, (const struct sockaddr*) &address, sizeof(address)) != 0 )
+    {
+        perror( "apdu_replay: unix" );
+        return -1;
+    }
+    fprintf( stderr, "apdu_replay: listening on %s\n", path );
+    return server;
+}
+
+static void usage()
+{
+    fprintf( stderr, "usage: apdu_replay (--tcp <port> | --unix <path> | --script <file>)"
+                     " [--reject] [--repeat <n>] [--quiet]\n" );
+}
+
+int main( int argc, char* argv[] )
+{
+    const char* script = NULL;
+    const char* unixPath = NULL;
+    int port = 0;
+    int repeat = 1;
+
+    for( int i = 1; i < argc; i++ )
+    {
+        const bool hasValue = (i + 1 < argc);
+
+        if( strcmp(argv[i], "--tcp") == 0 && hasValue )         port = atoi( argv[++i] );
+        else if( strcmp(argv[i], "--unix") == 0 && hasValue )   unixPath = argv[++i];
+        else if( strcmp(argv[i], "--script") == 0 && hasValue ) script = argv[++i];
+        else if( strcmp(argv[i], "--repeat") == 0 && hasValue ) repeat = atoi( argv[++i] );
+        else if( strcmp(argv[i], "--reject") == 0 )             G_reject = true;
+        else if( strcmp(argv[i], "--quiet") == 0 )              G_quiet = true;
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if( script != NULL )
+    {
+        return run_script( script, (repeat > 0) ? repeat : 1 );
+    }
+
+    int server = -1;
+    if( unixPath != NULL )
+    {
+        server = open_unix_server( unixPath );
+    }
+    else if( port > 0 )
+    {
+        server = open_tcp_server( port );
+    }
+    else
+    {
+        usage();
+        return 1;
+    }
+
+    return (server < 0) ? 1 : run_server( server );
+}
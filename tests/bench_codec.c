@@ -0,0 +1,117 @@
+/*******************************************************************************
+*   XYM Wallet
+*   (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+/*
+ * Throughput of base32_encode and snprintf_hex with each kernel the CPU
+ * supports, on the sizes the formatter sees (addresses, hashes and keys) and
+ * on a large buffer.
+ *
+ *   bench_codec [milliseconds per measure, default 200]
+ *
+ * Numbers only mean something with an optimised build (CMAKE_BUILD_TYPE=Release).
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "codec.h"
+#include "base32.h"
+#include "xym/format/printers.h"
+
+#define BULK_SIZE 4096
+
+typedef struct {
+    const char* name;
+    int         size;
+    bool        hex;
+} bench_case_t;
+
+static const bench_case_t CASES[] = {
+    { "base32 address (24 B)", 24, false },
+    { "base32 bulk (4 KiB)", BULK_SIZE, false },
+    { "hex hash (32 B)", 32, true },
+    { "hex mosaic id (8 B)", 8, true },
+    { "hex bulk (4 KiB)", BULK_SIZE, true },
+};
+
+static uint8_t input[BULK_SIZE];
+static char output[2 * BULK_SIZE + 1];
+
+static double now_seconds( void )
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int encode( const bench_case_t* bench )
+{
+    if( bench->hex ) {
+        return snprintf_hex( output, sizeof(output), input, bench->size, 1 );
+    }
+    return base32_encode( input, bench->size, output, sizeof(output) );
+}
+
+// MB/s of input
+static double measure( const bench_case_t* bench, double seconds )
+{
+    uint64_t iterations = 0;
+    unsigned int checksum = 0;
+    double start = now_seconds();
+    double elapsed;
+    do {
+        for( int i = 0; i < 1000; i++ ) {
+            checksum += encode( bench ) + (uint8_t) output[0];
+        }
+        iterations += 1000;
+        elapsed = now_seconds() - start;
+    } while( elapsed < seconds );
+
+    if( checksum == 0 ) {
+        printf( " " );  // keeps the calls from being optimised out
+    }
+    return iterations * bench->size / elapsed / 1e6;
+}
+
+int main( int argc, char* argv[] )
+{
+    double seconds = (argc > 1 ? atoi( argv[1] ) : 200) / 1000.0;
+
+    for( size_t i = 0; i < sizeof(input); i++ ) {
+        input[i] = (uint8_t) (i * 131 + 7);
+    }
+
+    printf( "%-24s", "MB/s" );
+    for( int kernel = 0; kernel < CODEC_KERNEL_COUNT; kernel++ ) {
+        if( codec_supported( (codec_kernel_e) kernel ) ) {
+            printf( " %10s", codec_kernel_name( (codec_kernel_e) kernel ) );
+        }
+    }
+    printf( "\n" );
+
+    for( size_t c = 0; c < sizeof(CASES) / sizeof(CASES[0]); c++ ) {
+        printf( "%-24s", CASES[c].name );
+        for( int kernel = 0; kernel < CODEC_KERNEL_COUNT; kernel++ ) {
+            if( codec_select( (codec_kernel_e) kernel ) ) {
+                printf( " %10.1f", measure( &CASES[c], seconds ) );
+                fflush( stdout );
+            }
+        }
+        printf( "\n" );
+    }
+    return 0;
+}
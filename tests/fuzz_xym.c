@@ -2,11 +2,8 @@
 #include "xym/format/format.h"
 #include "xym/parse/xym_parse.h"
 #include "buffer.h"
-#include "apdu/global.h"
 
 #include <stdlib.h>
-
-transaction_context_t transactionContext;
 fields_array_t  *fields = NULL;
 
 char *fieldName = NULL;
@@ -29,7 +26,7 @@ int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
     init_globals();
 
     buffer_t buf = {Data, Size, 0};
-    if (parse_txn_context(&buf, fields) != E_SUCCESS) {
+    if (parse_txn_context(&buf, false, fields) != E_SUCCESS) {
         return 0;
     }
 
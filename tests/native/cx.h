@@ -0,0 +1,102 @@
+/*******************************************************************************
+*   XYM Wallet
+*   (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_NATIVE_CX_H
+#define LEDGER_APP_XYM_NATIVE_CX_H
+
+/**
+ * Host stand-in for the subset of the BOLOS SDK 'cx.h' used by the app.
+ *
+ * SHA3-256 is a real implementation so that hashes computed by the app can
+ * be compared with reference values. Key derivation, public key generation
+ * and EdDSA signing are deterministic placeholders: they exercise the same
+ * code paths and buffer sizes but do NOT produce valid Ed25519 material.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CX_LAST                 (1 << 0)
+
+typedef enum
+{
+    CX_NONE = 0,
+    CX_RIPEMD160 = 1,
+    CX_SHA224 = 2,
+    CX_SHA256 = 3,
+    CX_SHA384 = 4,
+    CX_SHA512 = 5,
+    CX_KECCAK = 6,
+    CX_SHA3 = 7,
+} cx_md_t;
+
+typedef enum
+{
+    CX_CURVE_NONE = 0,
+    CX_CURVE_256K1 = 0x21,
+    CX_CURVE_Ed25519 = 0x41,
+} cx_curve_t;
+
+typedef struct
+{
+    cx_md_t algo;
+} cx_hash_t;
+
+typedef struct
+{
+    cx_hash_t      header;
+    size_t         output_size;
+    size_t         block_size;
+    size_t         blen;
+    uint8_t        block[200];
+    uint64_t       acc[25];
+} cx_sha3_t;
+
+typedef cx_sha3_t cx_ripemd160_t;
+
+typedef struct
+{
+    cx_curve_t     curve;
+    size_t         d_len;
+    uint8_t        d[64];
+} cx_ecfp_private_key_t;
+
+typedef struct
+{
+    cx_curve_t     curve;
+    size_t         W_len;
+    uint8_t        W[65];
+} cx_ecfp_public_key_t;
+
+int cx_sha3_init( cx_sha3_t* hash, size_t size );
+int cx_ripemd160_init( cx_ripemd160_t* hash );
+int cx_hash( cx_hash_t* hash, int mode, const uint8_t* in, size_t len, uint8_t* out, size_t out_len );
+uint8_t* cx_rng( uint8_t* buffer, size_t len );
+
+int cx_ecfp_init_private_key( cx_curve_t curve, const uint8_t* raw_key, size_t key_len, cx_ecfp_private_key_t* pvkey );
+int cx_ecfp_generate_pair2( cx_curve_t curve, cx_ecfp_public_key_t* pubkey, cx_ecfp_private_key_t* privkey,
+                            int keepprivate, cx_md_t hashID );
+int cx_eddsa_sign( const cx_ecfp_private_key_t* pvkey, int mode, cx_md_t hashID, const uint8_t* hash, size_t hash_len,
+                   const uint8_t* ctx, size_t ctx_len, uint8_t* sig, size_t sig_len, unsigned int* info );
+
+void os_perso_derive_node_bip32( cx_curve_t curve, const uint32_t* path, unsigned int pathLength,
+                                 unsigned char* privateKey, unsigned char* chain );
+void os_perso_derive_node_bip32_seed_key( unsigned int mode, cx_curve_t curve, const uint32_t* path,
+                                          unsigned int pathLength, unsigned char* privateKey,
+                                          unsigned char* chain, unsigned char* seed_key,
+                                          unsigned int seed_key_length );
+
+#endif // LEDGER_APP_XYM_NATIVE_CX_H
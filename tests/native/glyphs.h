@@ -0,0 +1,39 @@
+/*******************************************************************************
+*   XYM Wallet
+*   (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_NATIVE_GLYPHS_H
+#define LEDGER_APP_XYM_NATIVE_GLYPHS_H
+
+/**
+ * Host stand-in for the glyphs generated from the "glyphs" folder at build time.
+ */
+
+#include "ux.h"
+
+extern const bagl_icon_details_t C_badge_symbol;
+extern const bagl_icon_details_t C_badge_transaction;
+extern const bagl_icon_details_t C_icon_back;
+extern const bagl_icon_details_t C_icon_back_x;
+extern const bagl_icon_details_t C_icon_crossmark;
+extern const bagl_icon_details_t C_icon_dashboard;
+extern const bagl_icon_details_t C_icon_dashboard_x;
+extern const bagl_icon_details_t C_icon_eye;
+extern const bagl_icon_details_t C_icon_symbol;
+extern const bagl_icon_details_t C_icon_toggle_reset;
+extern const bagl_icon_details_t C_icon_toggle_set;
+extern const bagl_icon_details_t C_icon_validate_14;
+
+#endif // LEDGER_APP_XYM_NATIVE_GLYPHS_H
@@ -0,0 +1,725 @@
+/*******************************************************************************
+*   XYM Wallet
+*   (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "native_sdk.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "cx.h"
+#include "glyphs.h"
+#include "os_io_seproxyhal.h"
+
+try_context_t*  G_try_last_open_context = NULL;
+unsigned char   G_io_apdu_buffer[IO_APDU_BUFFER_SIZE];
+ux_state_t      G_ux;
+uint64_t        G_native_profile_ns[NATIVE_PROFILE_COUNT];
+
+static const native_transport_t* G_transport = NULL;
+static uint32_t G_screen_count = 0;
+static uint32_t G_init_count   = 0;
+
+#define NATIVE_GLYPH(name) const bagl_icon_details_t C_##name = { 14, 14 };
+NATIVE_GLYPH(badge_symbol)
+NATIVE_GLYPH(badge_transaction)
+NATIVE_GLYPH(icon_back)
+NATIVE_GLYPH(icon_back_x)
+NATIVE_GLYPH(icon_crossmark)
+NATIVE_GLYPH(icon_dashboard)
+NATIVE_GLYPH(icon_dashboard_x)
+NATIVE_GLYPH(icon_eye)
+NATIVE_GLYPH(icon_symbol)
+NATIVE_GLYPH(icon_toggle_reset)
+NATIVE_GLYPH(icon_toggle_set)
+NATIVE_GLYPH(icon_validate_14)
+
+
+/*******************************************************************************
+ * System
+ ******************************************************************************/
+
+void os_longjmp( unsigned int exception )
+{
+    if( G_try_last_open_context == NULL )
+    {
+        fprintf(stderr, "native: uncaught exception 0x%04X\n", exception);
+        abort();
+    }
+    longjmp( G_try_last_open_context->jmp_buf, exception );
+}
+
+void os_sched_exit( int exit_code )
+{
+    exit( exit_code );
+}
+
+void reset( void )
+{
+    fprintf(stderr, "native: device reset requested\n");
+    abort();
+}
+
+void nvm_write( void* dst_adr, void* src_adr, unsigned int src_len )
+{
+    if( src_adr == NULL )
+    {
+        memset( dst_adr, 0, src_len );
+        return;
+    }
+    memmove( dst_adr, src_adr, src_len );
+}
+
+uint64_t native_now_ns( void )
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+void native_profile_add( native_profile_e category, uint64_t startNs )
+{
+    G_native_profile_ns[category] += native_now_ns() - startNs;
+}
+
+// replaces the ticker count of the device build, see STATS_CLOCK_PERIOD_US
+uint32_t stats_clock( void )
+{
+    return (uint32_t) (native_now_ns() / 1000);
+}
+
+
+/*******************************************************************************
+ * IO
+ ******************************************************************************/
+
+void native_set_transport( const native_transport_t* transport )
+{
+    G_transport = transport;
+}
+
+void io_seproxyhal_io_heartbeat( void )
+{
+}
+
+void io_seproxyhal_spi_send( const unsigned char* buffer, unsigned short length )
+{
+    UNUSED(buffer);
+    UNUSED(length);
+}
+
+unsigned short io_seproxyhal_spi_recv( unsigned char* buffer, unsigned short maxlength, unsigned int flags )
+{
+    UNUSED(buffer);
+    UNUSED(maxlength);
+    UNUSED(flags);
+    return 0;
+}
+
+/**
+ * Mirrors the contract of the SDK 'io_exchange()' as used by 'io.c':
+ *  - a pending response (tx_len) is sent first, unless the reply is asynchronous,
+ *  - IO_RETURN_AFTER_TX returns right after sending,
+ *  - IO_ASYNCH_REPLY means the app waits for the user: the flow on screen is
+ *    answered by the transport before the next command is received.
+ * A host that goes away surfaces as EXCEPTION_IO_RESET, like an unplugged device.
+ */
+unsigned short io_exchange( unsigned char channel, unsigned short tx_len )
+{
+    if( G_transport == NULL )
+    {
+        THROW(EXCEPTION_IO_RESET);
+    }
+
+    if( tx_len > 0 && (channel & IO_ASYNCH_REPLY) == 0 )
+    {
+        if( !G_transport->send(G_io_apdu_buffer, tx_len) )
+        {
+            THROW(EXCEPTION_IO_RESET);
+        }
+    }
+
+    if( (channel & IO_RETURN_AFTER_TX) != 0 )
+    {
+        return 0;
+    }
+
+    if( (channel & IO_ASYNCH_REPLY) != 0 )
+    {
+        G_transport->on_user_interaction();
+    }
+
+    const int length = G_transport->receive(G_io_apdu_buffer, sizeof(G_io_apdu_buffer));
+    if( length <= 0 )
+    {
+        THROW(EXCEPTION_IO_RESET);
+    }
+    return (unsigned short) length;
+}
+
+
+/*******************************************************************************
+ * UX
+ ******************************************************************************/
+
+static unsigned int current_slot( void )
+{
+    return (G_ux.stack_count > 0) ? G_ux.stack_count - 1 : 0;
+}
+
+static bool is_special_step( const ux_flow_step_t* step )
+{
+    return step == FLOW_END_STEP || step == FLOW_BARRIER || step == FLOW_START || step == FLOW_LOOP;
+}
+
+static void display_current_step( void )
+{
+    const unsigned int slot = current_slot();
+    const ux_flow_state_t* flow = &G_ux.flow_stack[slot];
+    if( flow->steps == NULL || flow->index >= flow->length )
+    {
+        return;
+    }
+
+    const ux_flow_step_t* step = flow->steps[flow->index];
+    if( step->init != NULL )
+    {
+        // the step replaces its own layout, it usually moves to another step
+        G_init_count++;
+        step->init( slot );
+        return;
+    }
+
+    if( step->preinit != NULL )
+    {
+        step->preinit( slot );
+    }
+    G_screen_count++;
+}
+
+void native_ux_display( const bagl_element_t* elements, unsigned int count, bagl_element_callback_t prepro )
+{
+    // the loading screen relies on being rendered twice before running its action
+    for( int pass = 0; pass < 2; pass++ )
+    {
+        for( unsigned int i = 0; i < count; i++ )
+        {
+            if( prepro != NULL )
+            {
+                prepro( &elements[i] );
+            }
+        }
+    }
+    G_screen_count++;
+}
+
+unsigned int ux_stack_push( void )
+{
+    if( G_ux.stack_count < UX_STACK_SLOT_COUNT )
+    {
+        G_ux.stack_count++;
+    }
+    return current_slot();
+}
+
+void ux_flow_init( unsigned int stack_slot, const ux_flow_step_t* const* steps, const ux_flow_step_t* const start_step )
+{
+    ux_flow_state_t* flow = &G_ux.flow_stack[stack_slot];
+    flow->steps  = steps;
+    flow->index  = 0;
+    flow->length = 0;
+
+    while( steps[flow->length] != FLOW_END_STEP )
+    {
+        if( start_step != NULL && steps[flow->length] == start_step )
+        {
+            flow->index = flow->length;
+        }
+        flow->length++;
+    }
+
+    display_current_step();
+}
+
+static bool flow_loops( const ux_flow_state_t* flow )
+{
+    return flow->length > 0 && flow->steps[flow->length - 1] == FLOW_LOOP;
+}
+
+void ux_flow_next_no_display( void )
+{
+    ux_flow_state_t* flow = &G_ux.flow_stack[current_slot()];
+    if( flow->index + 1 < flow->length && !is_special_step(flow->steps[flow->index + 1]) )
+    {
+        flow->index++;
+    }
+    else if( flow_loops(flow) )
+    {
+        flow->index = 0;
+    }
+}
+
+void ux_flow_next( void )
+{
+    ux_flow_next_no_display();
+    display_current_step();
+}
+
+void ux_flow_prev( void )
+{
+    ux_flow_state_t* flow = &G_ux.flow_stack[current_slot()];
+    if( flow->index > 0 )
+    {
+        flow->index--;
+    }
+    else if( flow_loops(flow) )
+    {
+        flow->index = flow->length - 2;
+    }
+    display_current_step();
+}
+
+void ux_flow_validate( void )
+{
+    const ux_flow_step_t* step = ux_flow_get_current();
+    if( step != NULL && step->validate != NULL )
+    {
+        step->validate();
+    }
+}
+
+void ux_flow_relayout( void )
+{
+    display_current_step();
+}
+
+const ux_flow_step_t* ux_flow_get_current( void )
+{
+    const ux_flow_state_t* flow = &G_ux.flow_stack[current_slot()];
+    if( flow->steps == NULL || flow->index >= flow->length )
+    {
+        return NULL;
+    }
+    return flow->steps[flow->index];
+}
+
+const ux_flow_step_t* native_ux_current_step( void )
+{
+    return ux_flow_get_current();
+}
+
+/**
+ * Returns the text line 'line' of a step, based on the parameter order of its layout.
+ */
+const char* native_ux_step_text( const ux_flow_step_t* step, unsigned int line )
+{
+    if( step == NULL || step->layout == NULL )
+    {
+        return NULL;
+    }
+
+    // layouts starting with an icon ('p') carry their texts after it
+    const unsigned int first = (step->layout[0] == 'p') ? 1 : 0;
+    const unsigned int slot  = first + line;
+    if( slot >= 4 )
+    {
+        return NULL;
+    }
+    return (const char*) step->params[slot];
+}
+
+bool native_ux_step_has_text( const ux_flow_step_t* step, const char* text )
+{
+    for( unsigned int line = 0; line < 3; line++ )
+    {
+        const char* current = native_ux_step_text( step, line );
+        if( current != NULL && strcmp(current, text) == 0 )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * A press moved if the flow is on another step, or if it went through an
+ * init step: dynamic flows show new content on the same step that way.
+ */
+bool native_ux_press_right( void )
+{
+    const ux_flow_state_t* flow = &G_ux.flow_stack[current_slot()];
+    const unsigned short before = flow->index;
+    const uint32_t       inits  = G_init_count;
+    ux_flow_next();
+    return flow->index != before || G_init_count != inits;
+}
+
+bool native_ux_press_left( void )
+{
+    const ux_flow_state_t* flow = &G_ux.flow_stack[current_slot()];
+    const unsigned short before = flow->index;
+    const uint32_t       inits  = G_init_count;
+    ux_flow_prev();
+    return flow->index != before || G_init_count != inits;
+}
+
+bool native_ux_press_both( void )
+{
+    const ux_flow_step_t* step = ux_flow_get_current();
+    if( step == NULL || step->validate == NULL )
+    {
+        return false;
+    }
+    step->validate();
+    return true;
+}
+
+uint32_t native_ux_screen_count( void )
+{
+    return G_screen_count;
+}
+
+/**
+ * Advance widths of the printable ASCII characters in the 11 px regular
+ * font of the paging layouts: Open Sans Regular advances (2048 units per
+ * em) scaled to 11 px and rounded. Other bytes count as a space.
+ */
+static const uint8_t FONT_REGULAR_11PX_WIDTHS[0x7F - 0x20] =
+{
+     3,  3,  4,  7,  6,  9,  8,  2,  3,  3,  6,  6,  3,  4,  3,  4,  // 0x20
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  3,  3,  6,  6,  6,  5,  // 0x30
+    10,  7,  7,  7,  8,  6,  6,  8,  8,  3,  3,  7,  6, 10,  8,  9,  // 0x40
+     7,  9,  7,  6,  6,  8,  7, 10,  6,  6,  6,  4,  4,  4,  6,  5,  // 0x50
+     6,  6,  7,  5,  7,  6,  4,  6,  7,  3,  3,  6,  3, 10,  7,  7,  // 0x60
+     7,  7,  4,  5,  4,  7,  6,  9,  6,  6,  5,  4,  6,  4,  6,      // 0x70
+};
+
+static unsigned int char_width( char c )
+{
+    const unsigned char index = (unsigned char) c;
+    return (index >= 0x20 && index < 0x7F) ? FONT_REGULAR_11PX_WIDTHS[index - 0x20] : FONT_REGULAR_11PX_WIDTHS[0];
+}
+
+// start of the line after the one starting at 'text', wrapped at the last space that fits
+static const char* next_paging_line( const char* text )
+{
+    const char*  end       = text;
+    const char*  lastSpace = NULL;
+    unsigned int width     = 0;
+    while( *end != '\0' && *end != '\n' && width + char_width(*end) <= NATIVE_PAGING_LINE_WIDTH )
+    {
+        if( *end == ' ' )
+        {
+            lastSpace = end;
+        }
+        width += char_width( *end );
+        end++;
+    }
+
+    if( *end == '\n' )
+    {
+        return end + 1;
+    }
+    if( *end != '\0' && lastSpace != NULL )
+    {
+        return lastSpace + 1;
+    }
+    return (end == text) ? text + 1 : end;
+}
+
+uint32_t native_ux_paging_count( const char* text )
+{
+    uint32_t pages = 0;
+    do
+    {
+        pages++;
+        for( unsigned int line = 0; line < NATIVE_PAGING_LINES && *text != '\0'; line++ )
+        {
+            text = next_paging_line( text );
+        }
+    } while( *text != '\0' );
+    return pages;
+}
+
+
+/*******************************************************************************
+ * Crypto
+ ******************************************************************************/
+
+static const uint64_t KECCAK_ROUND_CONSTANTS[24] =
+{
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+    0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+static const uint8_t KECCAK_ROTATIONS[24] =
+{
+    1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+};
+
+static const uint8_t KECCAK_PI_LANES[24] =
+{
+    10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+};
+
+#define ROTL64(x, y) (((x) << (y)) | ((x) >> (64 - (y))))
+
+static void keccak_f1600( uint64_t st[25] )
+{
+    uint64_t bc[5];
+
+    for( int round = 0; round < 24; round++ )
+    {
+        // theta
+        for( int i = 0; i < 5; i++ )
+        {
+            bc[i] = st[i] ^ st[i + 5] ^ st[i + 10] ^ st[i + 15] ^ st[i + 20];
+        }
+        for( int i = 0; i < 5; i++ )
+        {
+            const uint64_t t = bc[(i + 4) % 5] ^ ROTL64(bc[(i + 1) % 5], 1);
+            for( int j = 0; j < 25; j += 5 )
+            {
+                st[j + i] ^= t;
+            }
+        }
+
+        // rho and pi
+        uint64_t t = st[1];
+        for( int i = 0; i < 24; i++ )
+        {
+            const int j = KECCAK_PI_LANES[i];
+            bc[0] = st[j];
+            st[j] = ROTL64(t, KECCAK_ROTATIONS[i]);
+            t = bc[0];
+        }
+
+        // chi
+        for( int j = 0; j < 25; j += 5 )
+        {
+            for( int i = 0; i < 5; i++ )
+            {
+                bc[i] = st[j + i];
+            }
+            for( int i = 0; i < 5; i++ )
+            {
+                st[j + i] ^= (~bc[(i + 1) % 5]) & bc[(i + 2) % 5];
+            }
+        }
+
+        // iota
+        st[0] ^= KECCAK_ROUND_CONSTANTS[round];
+    }
+}
+
+static void sha3_absorb_block( cx_sha3_t* hash, const uint8_t* block )
+{
+    for( size_t i = 0; i < hash->block_size / 8; i++ )
+    {
+        uint64_t lane = 0;
+        for( int b = 7; b >= 0; b-- )
+        {
+            lane = (lane << 8) | block[i * 8 + b];
+        }
+        hash->acc[i] ^= lane;
+    }
+    keccak_f1600( hash->acc );
+}
+
+static void sha3_update( cx_sha3_t* hash, const uint8_t* in, size_t len )
+{
+    while( len > 0 )
+    {
+        const size_t chunk = MIN(len, hash->block_size - hash->blen);
+        memcpy( hash->block + hash->blen, in, chunk );
+        hash->blen += chunk;
+        in  += chunk;
+        len -= chunk;
+
+        if( hash->blen == hash->block_size )
+        {
+            sha3_absorb_block( hash, hash->block );
+            hash->blen = 0;
+        }
+    }
+}
+
+static void sha3_final( cx_sha3_t* hash, uint8_t* out, size_t out_len )
+{
+    memset( hash->block + hash->blen, 0, hash->block_size - hash->blen );
+    hash->block[hash->blen] ^= 0x06;
+    hash->block[hash->block_size - 1] ^= 0x80;
+    sha3_absorb_block( hash, hash->block );
+
+    for( size_t i = 0; i < hash->output_size && i < out_len; i++ )
+    {
+        out[i] = (uint8_t) (hash->acc[i / 8] >> (8 * (i % 8)));
+    }
+}
+
+static void sha3_256( const uint8_t* in, size_t len, uint8_t out[32] )
+{
+    cx_sha3_t hash;
+    cx_sha3_init( &hash, 256 );
+    sha3_update( &hash, in, len );
+    sha3_final( &hash, out, 32 );
+}
+
+int cx_sha3_init( cx_sha3_t* hash, size_t size )
+{
+    memset( hash, 0, sizeof(*hash) );
+    hash->header.algo = CX_SHA3;
+    hash->output_size = size / 8;
+    hash->block_size  = 200 - 2 * hash->output_size;
+    return CX_SHA3;
+}
+
+/**
+ * Placeholder: RIPEMD-160 is only used for address derivation from the
+ * (placeholder) public key, so a truncated SHA3-256 is good enough here.
+ */
+int cx_ripemd160_init( cx_ripemd160_t* hash )
+{
+    cx_sha3_init( hash, 256 );
+    hash->header.algo = CX_RIPEMD160;
+    hash->output_size = 20;
+    return CX_RIPEMD160;
+}
+
+int cx_hash( cx_hash_t* hash, int mode, const uint8_t* in, size_t len, uint8_t* out, size_t out_len )
+{
+    const uint64_t start = native_now_ns();
+    cx_sha3_t* sha3 = (cx_sha3_t*) hash;
+
+    sha3_update( sha3, in, len );
+    if( (mode & CX_LAST) != 0 && out != NULL )
+    {
+        sha3_final( sha3, out, out_len );
+    }
+
+    native_profile_add( NATIVE_PROFILE_CRYPTO, start );
+    return (int) sha3->output_size;
+}
+
+void os_perso_derive_node_bip32( cx_curve_t curve, const uint32_t* path, unsigned int pathLength,
+                                 unsigned char* privateKey, unsigned char* chain )
+{
+    os_perso_derive_node_bip32_seed_key( HDW_NORMAL, curve, path, pathLength, privateKey, chain, NULL, 0 );
+}
+
+/**
+ * Not cryptographically secure, only used for upload session ids.
+ */
+uint8_t* cx_rng( uint8_t* buffer, size_t len )
+{
+    for( size_t i = 0; i < len; i++ )
+    {
+        buffer[i] = (uint8_t) rand();
+    }
+    return buffer;
+}
+
+/**
+ * Placeholder derivation: the key is a hash of the curve and the path.
+ */
+void os_perso_derive_node_bip32_seed_key( unsigned int mode, cx_curve_t curve, const uint32_t* path,
+                                          unsigned int pathLength, unsigned char* privateKey,
+                                          unsigned char* chain, unsigned char* seed_key,
+                                          unsigned int seed_key_length )
+{
+    const uint64_t start = native_now_ns();
+    UNUSED(mode);
+    UNUSED(seed_key);
+    UNUSED(seed_key_length);
+
+    cx_sha3_t hash;
+    const uint8_t curveByte = (uint8_t) curve;
+    cx_sha3_init( &hash, 256 );
+    sha3_update( &hash, &curveByte, 1 );
+    sha3_update( &hash, (const uint8_t*) path, pathLength * sizeof(uint32_t) );
+    sha3_final( &hash, privateKey, 32 );
+
+    if( chain != NULL )
+    {
+        sha3_256( privateKey, 32, chain );
+    }
+    native_profile_add( NATIVE_PROFILE_CRYPTO, start );
+}
+
+int cx_ecfp_init_private_key( cx_curve_t curve, const uint8_t* raw_key, size_t key_len, cx_ecfp_private_key_t* pvkey )
+{
+    pvkey->curve = curve;
+    pvkey->d_len = MIN(key_len, sizeof(pvkey->d));
+    memcpy( pvkey->d, raw_key, pvkey->d_len );
+    return (int) pvkey->d_len;
+}
+
+/**
+ * Placeholder key pair: W = 04 || H(d) || H(H(d)).
+ */
+int cx_ecfp_generate_pair2( cx_curve_t curve, cx_ecfp_public_key_t* pubkey, cx_ecfp_private_key_t* privkey,
+                            int keepprivate, cx_md_t hashID )
+{
+    const uint64_t start = native_now_ns();
+    UNUSED(keepprivate);
+    UNUSED(hashID);
+
+    pubkey->curve = curve;
+    pubkey->W_len = 65;
+    pubkey->W[0]  = 0x04;
+    sha3_256( privkey->d, privkey->d_len, &pubkey->W[1] );
+    sha3_256( &pubkey->W[1], 32, &pubkey->W[33] );
+
+    native_profile_add( NATIVE_PROFILE_CRYPTO, start );
+    return 0;
+}
+
+/**
+ * Placeholder signature: H(d || msg) || H(msg || d).
+ */
+int cx_eddsa_sign( const cx_ecfp_private_key_t* pvkey, int mode, cx_md_t hashID, const uint8_t* hash, size_t hash_len,
+                   const uint8_t* ctx, size_t ctx_len, uint8_t* sig, size_t sig_len, unsigned int* info )
+{
+    const uint64_t start = native_now_ns();
+    UNUSED(mode);
+    UNUSED(hashID);
+    UNUSED(ctx);
+    UNUSED(ctx_len);
+    UNUSED(info);
+
+    if( sig_len < 64 )
+    {
+        THROW(INVALID_PARAMETER);
+    }
+
+    cx_sha3_t state;
+    cx_sha3_init( &state, 256 );
+    sha3_update( &state, pvkey->d, pvkey->d_len );
+    sha3_update( &state, hash, hash_len );
+    sha3_final( &state, sig, 32 );
+
+    cx_sha3_init( &state, 256 );
+    sha3_update( &state, hash, hash_len );
+    sha3_update( &state, pvkey->d, pvkey->d_len );
+    sha3_final( &state, sig + 32, 32 );
+
+    native_profile_add( NATIVE_PROFILE_CRYPTO, start );
+    return 64;
+}
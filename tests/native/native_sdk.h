@@ -0,0 +1,76 @@
+/*******************************************************************************
+*   XYM Wallet
+*   (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_NATIVE_SDK_H
+#define LEDGER_APP_XYM_NATIVE_SDK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "os.h"
+#include "ux.h"
+
+/**
+ * Transport used by the native 'io_exchange()'.
+ */
+typedef struct
+{
+    bool (*send)( const uint8_t* response, size_t length );  ///< deliver response data + status word, false if the host went away
+    int  (*receive)( uint8_t* command, size_t size );        ///< block until the next command APDU, <= 0 if the host went away
+    void (*on_user_interaction)( void );                     ///< the app waits for the user, the pending flow must be answered
+} native_transport_t;
+
+/**
+ * Time spent in the different parts of the app, see 'native_profile_add()'.
+ */
+typedef enum
+{
+    NATIVE_PROFILE_PARSE,
+    NATIVE_PROFILE_FORMAT,
+    NATIVE_PROFILE_CRYPTO,
+    NATIVE_PROFILE_RESET,
+    NATIVE_PROFILE_COUNT
+} native_profile_e;
+
+extern uint64_t G_native_profile_ns[NATIVE_PROFILE_COUNT];
+
+void     native_set_transport( const native_transport_t* transport );
+uint64_t native_now_ns( void );
+void     native_profile_add( native_profile_e category, uint64_t startNs );
+
+/**
+ * Headless flow driver.
+ */
+const ux_flow_step_t* native_ux_current_step( void );
+const char*           native_ux_step_text( const ux_flow_step_t* step, unsigned int line );
+bool                  native_ux_step_has_text( const ux_flow_step_t* step, const char* text );
+bool                  native_ux_press_right( void );
+bool                  native_ux_press_left( void );
+bool                  native_ux_press_both( void );
+uint32_t              native_ux_screen_count( void );
+
+/**
+ * Pages the 'bnnn_paging' layout splits a text into on the 128 x 64 screen
+ * of the Nano X/S+: the title, then 3 lines of 114 pixels in the regular
+ * 11 px font, wrapped at spaces. The device pages within the step before
+ * moving the flow, each page is one right press.
+ */
+#define NATIVE_PAGING_LINE_WIDTH 114
+#define NATIVE_PAGING_LINES      3
+
+uint32_t              native_ux_paging_count( const char* text );
+
+#endif // LEDGER_APP_XYM_NATIVE_SDK_H
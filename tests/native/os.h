@@ -0,0 +1,153 @@
+/*******************************************************************************
+*   XYM Wallet
+*   (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_NATIVE_OS_H
+#define LEDGER_APP_XYM_NATIVE_OS_H
+
+/**
+ * Host stand-in for the subset of the BOLOS SDK 'os.h' used by the app.
+ *
+ * It lets the unmodified app sources (APDU dispatch, parser, formatter and
+ * the UI flows) be compiled and driven natively, see 'native_sdk.c'. Only
+ * the semantics the app relies on are reproduced; nothing here talks to a
+ * secure element.
+ */
+
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <bsd/string.h>
+#include "cx.h"
+
+#define IO_APDU_BUFFER_SIZE     260
+
+#define UNUSED(x)               (void)(x)
+#define PIC(x)                  (x)
+#ifndef MIN
+#define MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifdef HAVE_PRINTF
+#include <stdio.h>
+#define PRINTF(...)             fprintf(stderr, __VA_ARGS__)
+#else
+#define PRINTF(...)
+#endif
+
+// exceptions
+typedef unsigned short exception_t;
+
+#define EXCEPTION               1
+#define INVALID_PARAMETER       2
+#define EXCEPTION_OVERFLOW      3
+#define EXCEPTION_SECURITY      4
+#define INVALID_CRC             5
+#define INVALID_CHECKSUM        6
+#define INVALID_COUNTER         7
+#define NOT_SUPPORTED           8
+#define INVALID_STATE           9
+#define TIMEOUT                 10
+#define EXCEPTION_PIC           11
+#define EXCEPTION_APPEXIT       12
+#define EXCEPTION_IO_OVERFLOW   13
+#define EXCEPTION_IO_HEADER     14
+#define EXCEPTION_IO_STATE      15
+#define EXCEPTION_IO_RESET      16
+#define EXCEPTION_CXPORT        17
+#define EXCEPTION_SYSTEM        18
+
+typedef struct try_context_s
+{
+    jmp_buf                jmp_buf;
+    struct try_context_s*  previous;
+    exception_t            ex;
+} try_context_t;
+
+extern try_context_t* G_try_last_open_context;
+
+void os_longjmp( unsigned int exception ) __attribute__((noreturn));
+
+#define BEGIN_TRY_L(L)      { try_context_t __try##L;
+#define TRY_L(L)            __try##L.ex = setjmp(__try##L.jmp_buf);                     \
+                            if( __try##L.ex == 0 ) {                                    \
+                                __try##L.previous = G_try_last_open_context;            \
+                                G_try_last_open_context = &__try##L;
+#define CATCH_L(L, x)       goto __FINALLY##L;                                          \
+                            } else if( __try##L.ex == (x) ) {                           \
+                                __try##L.ex = 0;                                        \
+                                CLOSE_TRY_L(L);
+#define CATCH_OTHER_L(L, e) goto __FINALLY##L;                                          \
+                            } else {                                                    \
+                                exception_t e;                                          \
+                                e = __try##L.ex;                                        \
+                                __try##L.ex = 0;                                        \
+                                CLOSE_TRY_L(L);
+#define CATCH_ALL_L(L)      goto __FINALLY##L;                                          \
+                            } else {                                                    \
+                                __try##L.ex = 0;                                        \
+                                CLOSE_TRY_L(L);
+#define FINALLY_L(L)        goto __FINALLY##L;                                          \
+                            }                                                           \
+                            __FINALLY##L:                                               \
+                            if( G_try_last_open_context == &__try##L ) {                \
+                                CLOSE_TRY_L(L);                                         \
+                            }
+#define END_TRY_L(L)        if( __try##L.ex != 0 ) {                                    \
+                                THROW_L(L, __try##L.ex);                                \
+                            }                                                           \
+                            }
+#define CLOSE_TRY_L(L)      G_try_last_open_context = __try##L.previous
+#define THROW_L(L, x)       os_longjmp(x)
+
+#define BEGIN_TRY           BEGIN_TRY_L(_)
+#define TRY                 TRY_L(_)
+#define CATCH(x)            CATCH_L(_, x)
+#define CATCH_OTHER(e)      CATCH_OTHER_L(_, e)
+#define CATCH_ALL           CATCH_ALL_L(_)
+#define FINALLY             FINALLY_L(_)
+#define END_TRY             END_TRY_L(_)
+#define CLOSE_TRY           CLOSE_TRY_L(_)
+#define THROW(x)            THROW_L(_, x)
+
+// io
+extern unsigned char G_io_apdu_buffer[IO_APDU_BUFFER_SIZE];
+
+#define CHANNEL_APDU                0
+#define CHANNEL_KEYBOARD            1
+#define CHANNEL_SPI                 2
+#define IO_RESET_AFTER_REPLIED      0x80
+#define IO_RECEIVE_DATA             0x40
+#define IO_RETURN_AFTER_TX          0x20
+#define IO_ASYNCH_REPLY             0x10
+#define IO_FLAGS                    0xF8
+
+unsigned short io_exchange( unsigned char channel, unsigned short tx_len );
+
+// system
+#define HDW_NORMAL              0
+#define HDW_ED25519_SLIP10      1
+
+void os_sched_exit( int exit_code ) __attribute__((noreturn));
+void reset( void ) __attribute__((noreturn));
+
+// nvm: the flash storage is plain RAM, see 'storage.h'
+#define NVM_CONST
+
+void nvm_write( void* dst_adr, void* src_adr, unsigned int src_len );
+
+#endif // LEDGER_APP_XYM_NATIVE_OS_H
@@ -0,0 +1,27 @@
+/*******************************************************************************
+*   XYM Wallet
+*   (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_NATIVE_OS_IO_SEPROXYHAL_H
+#define LEDGER_APP_XYM_NATIVE_OS_IO_SEPROXYHAL_H
+
+#include "os.h"
+#include "ux.h"
+
+void io_seproxyhal_io_heartbeat( void );
+void io_seproxyhal_spi_send( const unsigned char* buffer, unsigned short length );
+unsigned short io_seproxyhal_spi_recv( unsigned char* buffer, unsigned short maxlength, unsigned int flags );
+
+#endif // LEDGER_APP_XYM_NATIVE_OS_IO_SEPROXYHAL_H
@@ -0,0 +1,157 @@
+/*******************************************************************************
+*   XYM Wallet
+*   (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#ifndef LEDGER_APP_XYM_NATIVE_UX_H
+#define LEDGER_APP_XYM_NATIVE_UX_H
+
+/**
+ * Host stand-in for the flow engine of the BOLOS SDK 'ux.h'.
+ *
+ * Steps keep their layout name and (up to four) layout parameters so that a
+ * host driver can find the "Approve"/"Reject" screens and read the text that
+ * would have been displayed. Flows are walked with the same index semantics
+ * as the SDK engine, see 'native_sdk.c'.
+ */
+
+#include "os.h"
+
+// bagl
+typedef struct
+{
+    unsigned int   type;
+    unsigned char  userid;
+    short          x;
+    short          y;
+    unsigned short width;
+    unsigned short height;
+    unsigned char  stroke;
+    unsigned char  radius;
+    unsigned char  fill;
+    unsigned int   fgcolor;
+    unsigned int   bgcolor;
+    unsigned short font_id;
+    unsigned char  icon_id;
+} bagl_component_t;
+
+typedef struct
+{
+    bagl_component_t component;
+    const char*      text;
+} bagl_element_t;
+
+typedef struct
+{
+    unsigned int   width;
+    unsigned int   height;
+} bagl_icon_details_t;
+
+#define BAGL_NONE                           0
+#define BAGL_RECTANGLE                      3
+#define BAGL_LABELINE                       7
+#define BAGL_FILL                           1
+#define BAGL_FONT_OPEN_SANS_EXTRABOLD_11px  8
+#define BAGL_FONT_ALIGNMENT_CENTER          0x8000
+
+typedef const bagl_element_t* (*bagl_element_callback_t)( const bagl_element_t* element );
+
+void native_ux_display( const bagl_element_t* elements, unsigned int count, bagl_element_callback_t prepro );
+
+#define UX_DISPLAY(elements, prepro)                                                        \
+    native_ux_display( elements, sizeof(elements) / sizeof(elements[0]), prepro );
+
+#define UX_CALLBACK_SET_INTERVAL(ms)
+
+// flows
+typedef struct ux_flow_step_s
+{
+    void        (*init)( unsigned int stack_slot );     ///< replaces the layout (UX_STEP_INIT)
+    void        (*preinit)( unsigned int stack_slot );  ///< runs before the layout is drawn
+    void        (*validate)( void );                    ///< both buttons pressed
+    const char*  layout;                                ///< layout kind, e.g. "bnnn_paging"
+    const void*  params[4];                             ///< layout parameters, in declaration order
+} ux_flow_step_t;
+
+#define FLOW_END_STEP   ((const ux_flow_step_t*) 0xFFFFFFFFUL)
+#define FLOW_BARRIER    ((const ux_flow_step_t*) 0xFFFFFFFEUL)
+#define FLOW_START      ((const ux_flow_step_t*) 0xFFFFFFFDUL)
+#define FLOW_LOOP       ((const ux_flow_step_t*) 0xFFFFFFFCUL)
+
+#define UX_STACK_SLOT_COUNT 4
+
+typedef struct
+{
+    const ux_flow_step_t* const* steps;
+    unsigned short               index;
+    unsigned short               length;
+} ux_flow_state_t;
+
+typedef struct
+{
+    unsigned int     stack_count;
+    ux_flow_state_t  flow_stack[UX_STACK_SLOT_COUNT];
+} ux_state_t;
+
+extern ux_state_t G_ux;
+
+#define UX_STEP_NOCB(stepname, layoutkind, ...)                                             \
+    const ux_flow_step_t stepname = { NULL, NULL, NULL, #layoutkind, __VA_ARGS__ }
+
+#define UX_STEP_NOCB_INIT(stepname, layoutkind, preinit_code, ...)                          \
+    static void stepname##_preinit( unsigned int stack_slot ) {                             \
+        UNUSED(stack_slot);                                                                 \
+        preinit_code;                                                                       \
+    }                                                                                       \
+    const ux_flow_step_t stepname = { NULL, stepname##_preinit, NULL, #layoutkind, __VA_ARGS__ }
+
+#define UX_STEP_CB(stepname, layoutkind, validate_code, ...)                                \
+    static void stepname##_validate( void ) {                                               \
+        validate_code;                                                                      \
+    }                                                                                       \
+    const ux_flow_step_t stepname = { NULL, NULL, stepname##_validate, #layoutkind, __VA_ARGS__ }
+
+#define UX_STEP_CB_INIT(stepname, layoutkind, preinit_code, validate_code, ...)            \
+    static void stepname##_preinit( unsigned int stack_slot ) {                             \
+        UNUSED(stack_slot);                                                                 \
+        preinit_code;                                                                       \
+    }                                                                                       \
+    static void stepname##_validate( void ) {                                               \
+        validate_code;                                                                      \
+    }                                                                                       \
+    const ux_flow_step_t stepname = { NULL, stepname##_preinit, stepname##_validate, #layoutkind, __VA_ARGS__ }
+
+#define UX_STEP_VALID(stepname, layoutkind, validate_code, ...)                             \
+    UX_STEP_CB(stepname, layoutkind, validate_code, __VA_ARGS__)
+
+#define UX_STEP_INIT(stepname, validate_flow, error_flow, init_code)                        \
+    static void stepname##_init( unsigned int stack_slot ) {                                \
+        UNUSED(stack_slot);                                                                 \
+        init_code;                                                                          \
+    }                                                                                       \
+    const ux_flow_step_t stepname = { stepname##_init, NULL, NULL, "init", { NULL } }
+
+#define UX_FLOW(flowname, ...)                                                              \
+    const ux_flow_step_t* const flowname[] = { __VA_ARGS__, FLOW_END_STEP }
+
+unsigned int ux_stack_push( void );
+void ux_flow_init( unsigned int stack_slot, const ux_flow_step_t* const* steps, const ux_flow_step_t* const start_step );
+void ux_flow_next( void );
+void ux_flow_prev( void );
+void ux_flow_next_no_display( void );
+void ux_flow_validate( void );
+void ux_flow_relayout( void );
+const ux_flow_step_t* ux_flow_get_current( void );
+
+#endif // LEDGER_APP_XYM_NATIVE_UX_H
@@ -0,0 +1,255 @@
+/*******************************************************************************
+*   XYM Wallet
+*   (c) 2020 FDS
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+/**
+ * Review flow metrics.
+ *
+ * Parses each transaction, starts the real review flow ('display_review_menu()')
+ * on the SDK stand-in found in 'native/' and walks it to "Approve" the way a
+ * user does: right presses through every screen, the pages the 'bnnn_paging'
+ * layout makes of a long value included (see 'native_ux_paging_count()'),
+ * then both buttons.
+ *
+ * Usage:
+ *   review_metrics [--fast-cosign] [file.raw | directory ...]     default: ../testcases
+ *
+ * With --fast-cosign the "Fast cosign" setting is enabled first and every
+ * cosignature of a hash is flagged as such, as by a host that knows it is
+ * cosigning: they are then approved on their hash alone. Without it, they
+ * are reviewed in full after the warning of an unknown network.
+ *
+ * Prints per transaction the fields, the review screens the app produces,
+ * the screens on the device once paged, and the button presses from the
+ * first screen to the approval (one per screen, the walk never skips any),
+ * then the corpus totals. Transactions the
+ * parser refuses on both networks are listed as refused.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <native_sdk.h>
+
+#include "arena.h"
+#include "storage.h"
+#include "ui/transaction/review_menu.h"
+
+#define MAX_USER_STEPS 2000
+#define MAX_NAMES      4096
+
+typedef struct
+{
+    uint32_t fields;
+    uint32_t reviewScreens;   ///< screens the review step shows, index screens included
+    uint32_t deviceScreens;   ///< every screen up to "Approve" included, once paged
+    uint32_t presses;         ///< right presses plus the final press on both buttons
+} review_metrics_t;
+
+static bool G_approved;
+static bool G_fast_cosign;
+
+static void on_review_result( unsigned int result )
+{
+    G_approved = (result == OPTION_SIGN);
+}
+
+/**
+ * Walks the review flow on screen to "Approve" and presses both buttons.
+ */
+static bool walk_to_approval( review_metrics_t* metrics )
+{
+    for( int i = 0; i < MAX_USER_STEPS; i++ )
+    {
+        const ux_flow_step_t* step = native_ux_current_step();
+        if( step == NULL )
+        {
+            return false;
+        }
+
+        if( step->validate != NULL && native_ux_step_has_text(step, "Approve") )
+        {
+            metrics->deviceScreens++;
+            metrics->presses++;
+            native_ux_press_both();
+            return G_approved;
+        }
+
+        uint32_t pages = 1;
+        if( strcmp(step->layout, "bnnn_paging") == 0 )
+        {
+            pages = native_ux_paging_count( G_arena.review.fieldValue );
+            metrics->reviewScreens++;
+        }
+        metrics->deviceScreens += pages;
+        metrics->presses += pages;
+
+        if( !native_ux_press_right() )
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
+static bool measure( const uint8_t* data, size_t length, review_metrics_t* metrics )
+{
+    memset( metrics, 0, sizeof(*metrics) );
+
+    int status = -1;
+    for( int mainnet = 0; mainnet <= 1 && status != 0; mainnet++ )
+    {
+        arena_enter( ARENA_REVIEW );
+        buffer_t buffer = { data, length, 0 };
+        status = parse_txn_context( &buffer, mainnet == 1, &G_arena.review.fields );
+    }
+    if( status != 0 )
+    {
+        return false;
+    }
+
+    metrics->fields = G_arena.review.fields.numFields;
+    G_approved = false;
+    const bool cosignature = G_fast_cosign && G_arena.review.fields.signLength == XYM_TRANSACTION_HASH_LENGTH;
+    display_review_menu( &G_arena.review.fields, cosignature, on_review_result );
+    return walk_to_approval( metrics );
+}
+
+static uint8_t* read_file( const char* path, size_t* length )
+{
+    FILE* f = fopen( path, "rb" );
+    if( f == NULL )
+    {
+        return NULL;
+    }
+    fseek( f, 0, SEEK_END );
+    *length = ftell( f );
+    fseek( f, 0, SEEK_SET );
+
+    uint8_t* data = malloc( *length > 0 ? *length : 1 );
+    if( data != NULL && fread(data, 1, *length, f) != *length )
+    {
+        free( data );
+        data = NULL;
+    }
+    fclose( f );
+    return data;
+}
+
+static int compare_paths( const void* a, const void* b )
+{
+    return strcmp( *(char* const*) a, *(char* const*) b );
+}
+
+// the .raw files of a directory, or the argument itself
+static size_t collect( const char* argument, char** paths, size_t count )
+{
+    DIR* dir = opendir( argument );
+    if( dir == NULL )
+    {
+        if( count < MAX_NAMES )
+        {
+            paths[count++] = strdup( argument );
+        }
+        return count;
+    }
+
+    const size_t first = count;
+    struct dirent* entry;
+    while( (entry = readdir(dir)) != NULL && count < MAX_NAMES )
+    {
+        const size_t nameLength = strlen( entry->d_name );
+        if( nameLength > 4 && strcmp(entry->d_name + nameLength - 4, ".raw") == 0 )
+        {
+            char* path = malloc( strlen(argument) + nameLength + 2 );
+            sprintf( path, "%s/%s", argument, entry->d_name );
+            paths[count++] = path;
+        }
+    }
+    closedir( dir );
+    qsort( paths + first, count - first, sizeof(char*), compare_paths );
+    return count;
+}
+
+int main( int argc, char* argv[] )
+{
+    static char* paths[MAX_NAMES];
+    size_t count = 0;
+    int first = 1;
+    if( argc > 1 && strcmp(argv[1], "--fast-cosign") == 0 )
+    {
+        uint8_t enabled = 1;
+        nvm_write( (void*) &N_storage.fastCosign, &enabled, sizeof(enabled) );
+        G_fast_cosign = true;
+        first++;
+    }
+    for( int i = first; i < argc; i++ )
+    {
+        count = collect( argv[i], paths, count );
+    }
+    if( argc == first )
+    {
+        count = collect( "../testcases", paths, count );
+    }
+
+    review_metrics_t total = { 0 };
+    unsigned int measured = 0, refused = 0;
+
+    printf( "%-44s %7s %7s %7s %7s\n", "transaction", "fields", "review", "screens", "presses" );
+    for( size_t i = 0; i < count; i++ )
+    {
+        const char* name = strrchr( paths[i], '/' ) ? strrchr( paths[i], '/' ) + 1 : paths[i];
+        size_t length;
+        uint8_t* data = read_file( paths[i], &length );
+        review_metrics_t metrics;
+
+        if( data == NULL )
+        {
+            fprintf( stderr, "review_metrics: cannot read %s\n", paths[i] );
+            free( paths[i] );
+            return 1;
+        }
+        if( !measure(data, length, &metrics) )
+        {
+            printf( "%-44s refused\n", name );
+            refused++;
+        }
+        else
+        {
+            printf( "%-44s %7u %7u %7u %7u\n", name, metrics.fields, metrics.reviewScreens,
+                    metrics.deviceScreens, metrics.presses );
+            total.fields        += metrics.fields;
+            total.reviewScreens += metrics.reviewScreens;
+            total.deviceScreens += metrics.deviceScreens;
+            total.presses       += metrics.presses;
+            measured++;
+        }
+        arena_enter( ARENA_IDLE );
+        free( data );
+        free( paths[i] );
+    }
+
+    printf( "%-44s %7u %7u %7u %7u\n", "total", total.fields, total.reviewScreens, total.deviceScreens, total.presses );
+    if( measured > 0 )
+    {
+        printf( "%-44s %7.1f %7.1f %7.1f %7.1f\n", "mean", (double) total.fields / measured,
+                (double) total.reviewScreens / measured, (double) total.deviceScreens / measured,
+                (double) total.presses / measured );
+    }
+    printf( "%u transactions, %u refused\n", measured, refused );
+    return 0;
+}
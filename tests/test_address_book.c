@@ -0,0 +1,249 @@
+/*
+ * Address book kept in N_storage, with nvm_write() replaced by a copy that
+ * counts the bytes written to flash and can simulate a power loss.
+ */
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmocka.h"
+
+#include "address_book.h"
+#include "storage.h"
+
+#define LOOKUPS 1000000
+
+static unsigned int G_nvm_writes;
+static size_t G_nvm_bytes;
+
+// when not zero, the write with this number only writes half of its bytes and the power goes
+static unsigned int G_power_loss_at;
+static jmp_buf G_power_loss;
+
+void nvm_write(void *dst_adr, void *src_adr, unsigned int src_len) {
+    uint8_t *start = (uint8_t *) &N_storage_real;
+    assert_true((uint8_t *) dst_adr >= start);
+    assert_true((uint8_t *) dst_adr + src_len <= start + sizeof(N_storage_real));
+    G_nvm_writes++;
+    if (G_nvm_writes == G_power_loss_at) {
+        memmove(dst_adr, src_adr, src_len / 2);
+        longjmp(G_power_loss, 1);
+    }
+    memmove(dst_adr, src_adr, src_len);
+    G_nvm_bytes += src_len;
+}
+
+static void random_address(uint8_t *address) {
+    address[0] = 0x98;
+    for (int i = 1; i < XYM_ADDRESS_LENGTH; i++) {
+        address[i] = (uint8_t) rand();
+    }
+}
+
+// every test starts on an empty book, as after the install
+static void clear_storage(void) {
+    memset((void *) &N_storage_real, 0, sizeof(N_storage_real));
+    G_nvm_writes = 0;
+    G_nvm_bytes = 0;
+    G_power_loss_at = 0;
+}
+
+// fills the book, 'addresses' receives the entries in insertion order
+static void fill(uint8_t addresses[][XYM_ADDRESS_LENGTH], uint16_t count) {
+    char label[MAX_CONTACT_LABEL_LEN + 1];
+    for (uint16_t i = 0; i < count; i++) {
+        random_address(addresses[i]);
+        snprintf(label, sizeof(label), "contact %u", i);
+        assert_true(address_book_add(addresses[i], label));
+    }
+    assert_int_equal(address_book_count(), count);
+}
+
+static void assert_sorted(void) {
+    const address_book_t *book = (const address_book_t *) &N_storage_real.addressBook;
+    for (uint16_t i = 1; i < book->count; i++) {
+        assert_true(memcmp(book->entries[i - 1].address, book->entries[i].address, XYM_ADDRESS_LENGTH) < 0);
+    }
+}
+
+static void test_add_and_find(void **state) {
+    (void) state;
+    clear_storage();
+    static uint8_t addresses[MAX_ADDRESS_BOOK_ENTRIES][XYM_ADDRESS_LENGTH];
+    srand(1);
+    fill(addresses, 100);
+    assert_sorted();
+
+    char label[MAX_CONTACT_LABEL_LEN + 1];
+    for (uint16_t i = 0; i < 100; i++) {
+        const address_entry_t *entry = address_book_find(addresses[i]);
+        assert_non_null(entry);
+        assert_memory_equal(entry->address, addresses[i], XYM_ADDRESS_LENGTH);
+        snprintf(label, sizeof(label), "contact %u", i);
+        assert_string_equal(entry->label, label);
+    }
+
+    uint8_t unknown[XYM_ADDRESS_LENGTH];
+    random_address(unknown);
+    assert_null(address_book_find(unknown));
+}
+
+static void test_rename(void **state) {
+    (void) state;
+    clear_storage();
+    uint8_t address[XYM_ADDRESS_LENGTH];
+    random_address(address);
+    assert_true(address_book_add(address, "first name"));
+    assert_true(address_book_add(address, "second"));
+    assert_int_equal(address_book_count(), 1);
+    assert_string_equal(address_book_find(address)->label, "second");
+
+    // labels are cut, and always terminated
+    assert_true(address_book_add(address, "a label longer than the limit"));
+    assert_int_equal(strlen(address_book_find(address)->label), MAX_CONTACT_LABEL_LEN);
+}
+
+static void test_remove(void **state) {
+    (void) state;
+    clear_storage();
+    static uint8_t addresses[10][XYM_ADDRESS_LENGTH];
+    srand(2);
+    fill(addresses, 10);
+
+    assert_true(address_book_remove(addresses[3]));
+    assert_false(address_book_remove(addresses[3]));
+    assert_null(address_book_find(addresses[3]));
+    assert_int_equal(address_book_count(), 9);
+    assert_sorted();
+    for (uint16_t i = 0; i < 10; i++) {
+        assert_true(i == 3 || address_book_find(addresses[i]) != NULL);
+    }
+
+    // the freed entry is wiped
+    const address_book_t *book = (const address_book_t *) &N_storage_real.addressBook;
+    const address_entry_t empty = {0};
+    assert_memory_equal(&book->entries[9], &empty, sizeof(empty));
+}
+
+static void test_full(void **state) {
+    (void) state;
+    clear_storage();
+    static uint8_t addresses[MAX_ADDRESS_BOOK_ENTRIES][XYM_ADDRESS_LENGTH];
+    srand(3);
+    fill(addresses, MAX_ADDRESS_BOOK_ENTRIES);
+    assert_sorted();
+
+    uint8_t another[XYM_ADDRESS_LENGTH];
+    random_address(another);
+    assert_false(address_book_add(another, "one too many"));
+    assert_int_equal(address_book_count(), MAX_ADDRESS_BOOK_ENTRIES);
+
+    // a known address can still be renamed
+    assert_true(address_book_add(addresses[0], "renamed"));
+    assert_string_equal(address_book_find(addresses[0])->label, "renamed");
+}
+
+typedef enum { ADD, RENAME, REMOVE } update_t;
+
+static bool run_update(update_t update, const uint8_t *address) {
+    return update == REMOVE ? address_book_remove(address)
+                            : address_book_add(address, update == ADD ? "added" : "renamed");
+}
+
+// cuts the update at each of its writes: once recovered, the book is as before or as after it
+static void check_power_loss(update_t update, const uint8_t *address) {
+    static internal_storage_t before, after;
+    memcpy(&before, (const void *) &N_storage_real, sizeof(before));
+    G_nvm_writes = 0;
+    assert_true(run_update(update, address));
+    memcpy(&after, (const void *) &N_storage_real, sizeof(after));
+    const unsigned int writes = G_nvm_writes;
+    memcpy((void *) &N_storage_real, &before, sizeof(before));
+
+    for (unsigned int cut = 1; cut <= writes; cut++) {
+        G_nvm_writes = 0;
+        G_power_loss_at = cut;
+        if (setjmp(G_power_loss) == 0) {
+            run_update(update, address);
+            fail_msg("write %u of %u was not reached", cut, writes);
+        }
+        G_power_loss_at = 0;
+        address_book_recover();
+
+        // what is left of the journal does not matter once it is idle
+        const address_book_t *book = (const address_book_t *) &N_storage_real.addressBook;
+        const bool untouched = memcmp(book->entries, before.addressBook.entries, sizeof(book->entries)) == 0 &&
+                               book->count == before.addressBook.count;
+        const bool done = memcmp(book->entries, after.addressBook.entries, sizeof(book->entries)) == 0 &&
+                          book->count == after.addressBook.count;
+        assert_int_equal(book->journal.update, ADDRESS_BOOK_IDLE);
+        assert_true(untouched || done);
+        assert_true(cut > 2 || untouched);   // the journal is not marked yet
+        memcpy((void *) &N_storage_real, &before, sizeof(before));
+    }
+}
+
+static void test_power_loss(void **state) {
+    (void) state;
+    clear_storage();
+    static uint8_t addresses[10][XYM_ADDRESS_LENGTH];
+    srand(5);
+    fill(addresses, 10);
+
+    // new entries at the start, in the middle and at the end of the book
+    uint8_t address[XYM_ADDRESS_LENGTH];
+    random_address(address);
+    for (uint8_t first = 0x00; first < 0x03; first++) {
+        address[1] = (uint8_t) (first * 0x7F);
+        check_power_loss(ADD, address);
+    }
+    check_power_loss(RENAME, addresses[4]);
+    for (uint16_t i = 0; i < 10; i += 3) {
+        check_power_loss(REMOVE, addresses[i]);
+    }
+}
+
+static void test_lookup_benchmark(void **state) {
+    (void) state;
+    clear_storage();
+    static uint8_t addresses[MAX_ADDRESS_BOOK_ENTRIES][XYM_ADDRESS_LENGTH];
+    srand(4);
+    fill(addresses, MAX_ADDRESS_BOOK_ENTRIES);
+    printf("%u entries written with %u nvm writes (%zu bytes)\n", MAX_ADDRESS_BOOK_ENTRIES, G_nvm_writes, G_nvm_bytes);
+
+    // half of the lookups miss
+    uint8_t unknown[XYM_ADDRESS_LENGTH];
+    random_address(unknown);
+    unsigned int found = 0;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned int i = 0; i < LOOKUPS; i++) {
+        const uint8_t *address = (i & 1) ? unknown : addresses[i % MAX_ADDRESS_BOOK_ENTRIES];
+        found += address_book_find(address) != NULL;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    const double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    assert_int_equal(found, LOOKUPS / 2);
+    printf("%u lookups among %u entries in %.3f ms (%.1f ns each)\n", LOOKUPS, MAX_ADDRESS_BOOK_ENTRIES,
+           seconds * 1e3, seconds * 1e9 / LOOKUPS);
+}
+
+int main(void) {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_add_and_find),
+        cmocka_unit_test(test_rename),
+        cmocka_unit_test(test_remove),
+        cmocka_unit_test(test_full),
+        cmocka_unit_test(test_power_loss),
+        cmocka_unit_test(test_lookup_benchmark),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,167 @@
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmocka.h"
+
+#include "codec.h"
+#include "base32.h"
+#include "xym/format/printers.h"
+
+#define MAX_INPUT 300
+
+static uint8_t input[MAX_INPUT];
+
+static void fill_input(unsigned int seed) {
+    srand(seed);
+    for (size_t i = 0; i < sizeof(input); i++) {
+        input[i] = (uint8_t) rand();
+    }
+}
+
+static void select_kernel(codec_kernel_e kernel) {
+    assert_true(codec_select(kernel));
+    assert_int_equal(codec_kernel(), kernel);
+}
+
+static void test_base32_vectors(void **state) {
+    (void) state;
+    // RFC 4648 test vectors, through every kernel the CPU has
+    const char *vectors[][2] = {
+        {"", ""},
+        {"f", "MY======"},
+        {"fo", "MZXQ===="},
+        {"foo", "MZXW6==="},
+        {"foob", "MZXW6YQ="},
+        {"fooba", "MZXW6YTB"},
+        {"foobar", "MZXW6YTBOI======"},
+        {"foobarfoobarfoobarfoobarfoobar", "MZXW6YTBOJTG633CMFZGM33PMJQXEZTPN5RGC4TGN5XWEYLS"},
+    };
+    char out[128];
+
+    for (int kernel = 0; kernel < CODEC_KERNEL_COUNT; kernel++) {
+        if (!codec_supported((codec_kernel_e) kernel)) {
+            continue;
+        }
+        select_kernel((codec_kernel_e) kernel);
+        for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+            int length = (int) strlen(vectors[i][0]);
+            assert_int_equal(base32_encode((const uint8_t *) vectors[i][0], length, out, sizeof(out)), strlen(vectors[i][1]));
+            assert_string_equal(out, vectors[i][1]);
+        }
+    }
+}
+
+static void test_base32_cross_check(void **state) {
+    (void) state;
+    char expected[MAX_INPUT * 2];
+    char actual[MAX_INPUT * 2];
+
+    fill_input(42);
+    for (int kernel = CODEC_SCALAR + 1; kernel < CODEC_KERNEL_COUNT; kernel++) {
+        if (!codec_supported((codec_kernel_e) kernel)) {
+            continue;
+        }
+        for (int length = 0; length <= MAX_INPUT; length++) {
+            int needed = (length + 4) / 5 * 8 + 1;
+            // room to spare, exact room, one character short
+            const int sizes[] = {(int) sizeof(actual), needed, needed - 1};
+            for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+                for (int offset = 0; offset < 3 && offset + length <= MAX_INPUT; offset++) {
+                    memset(expected, '#', sizeof(expected));
+                    memset(actual, '#', sizeof(actual));
+                    select_kernel(CODEC_SCALAR);
+                    int expectedCount = base32_encode(input + offset, length, expected, sizes[s]);
+                    select_kernel((codec_kernel_e) kernel);
+                    int actualCount = base32_encode(input + offset, length, actual, sizes[s]);
+                    assert_int_equal(actualCount, expectedCount);
+                    assert_memory_equal(actual, expected, sizeof(actual));
+                }
+            }
+        }
+    }
+}
+
+static void test_hex_cross_check(void **state) {
+    (void) state;
+    char expected[MAX_INPUT * 2 + 8];
+    char actual[MAX_INPUT * 2 + 8];
+
+    fill_input(7);
+    for (int kernel = CODEC_SCALAR + 1; kernel < CODEC_KERNEL_COUNT; kernel++) {
+        if (!codec_supported((codec_kernel_e) kernel)) {
+            continue;
+        }
+        for (uint16_t length = 0; length <= MAX_INPUT; length++) {
+            for (uint8_t reverse = 0; reverse < 3; reverse++) {
+                // 'reverse' other than 1 keeps the order, as on the device
+                uint16_t maxLen = (uint16_t) (2 * length + 1 + (length & 1));
+                memset(expected, '#', sizeof(expected));
+                memset(actual, '#', sizeof(actual));
+                select_kernel(CODEC_SCALAR);
+                int expectedCount = snprintf_hex(expected, maxLen, input, length, reverse);
+                select_kernel((codec_kernel_e) kernel);
+                int actualCount = snprintf_hex(actual, maxLen, input, length, reverse);
+                assert_int_equal(actualCount, expectedCount);
+                assert_memory_equal(actual, expected, sizeof(actual));
+            }
+
+            memset(expected, '#', sizeof(expected));
+            memset(actual, '#', sizeof(actual));
+            select_kernel(CODEC_SCALAR);
+            int expectedCount = snprintf_hex2ascii(expected, sizeof(expected), input + 1, length);
+            select_kernel((codec_kernel_e) kernel);
+            int actualCount = snprintf_hex2ascii(actual, sizeof(actual), input + 1, length);
+            assert_int_equal(actualCount, expectedCount);
+            assert_memory_equal(actual, expected, sizeof(actual));
+        }
+    }
+}
+
+static void test_kernel_selection(void **state) {
+    (void) state;
+    assert_true(codec_supported(CODEC_SCALAR));
+    for (int kernel = 0; kernel < CODEC_KERNEL_COUNT; kernel++) {
+        codec_kernel_e previous = codec_kernel();
+        if (codec_supported((codec_kernel_e) kernel)) {
+            select_kernel((codec_kernel_e) kernel);
+        } else {
+            assert_false(codec_select((codec_kernel_e) kernel));
+            assert_int_equal(codec_kernel(), previous);
+        }
+    }
+
+    // the scalar entry encodes too, for a caller that checked before a switch
+    char out[17];
+    select_kernel(CODEC_SCALAR);
+    codec_base32((const uint8_t *) "foobarfoob", 2, out);
+    out[16] = '\0';
+    assert_string_equal(out, "MZXW6YTBOJTG633C");
+    codec_hex((const uint8_t *) "\x01\xAB", 2, out, true);
+    out[4] = '\0';
+    assert_string_equal(out, "AB01");
+
+    printf("kernels:");
+    for (int kernel = 0; kernel < CODEC_KERNEL_COUNT; kernel++) {
+        if (codec_supported((codec_kernel_e) kernel)) {
+            printf(" %s", codec_kernel_name((codec_kernel_e) kernel));
+        }
+    }
+    printf("\n");
+}
+
+int main(void) {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_kernel_selection),
+        cmocka_unit_test(test_base32_vectors),
+        cmocka_unit_test(test_base32_cross_check),
+        cmocka_unit_test(test_hex_cross_check),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
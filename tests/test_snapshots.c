@@ -0,0 +1,229 @@
+/*
+ * Renders every transaction of a corpus with the display library and
+ * compares the screens with the snapshot stored next to it: 'name.raw' is
+ * checked against 'name.txt'.
+ *
+ *   test_snapshots [--update] [directory...]
+ *
+ * The directories default to ../testcases. With --update, missing or
+ * different snapshots are (re)written instead of failing, review them with
+ * git diff.
+ */
+#include <dirent.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmocka.h"
+
+#include "symbol_display.h"
+
+#define MAX_DIRECTORIES 16
+
+typedef struct {
+    char*  text;
+    size_t length;
+    size_t size;
+} text_t;
+
+static const char* G_directories[MAX_DIRECTORIES];
+static int G_directory_count;
+static bool G_update;
+
+static void append(text_t* text, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+static void append(text_t* text, const char* format, ...) {
+    va_list args;
+    for (;;) {
+        va_start(args, format);
+        int written = vsnprintf(text->text + text->length, text->size - text->length, format, args);
+        va_end(args);
+        assert_true(written >= 0);
+        if (text->length + written < text->size) {
+            text->length += written;
+            return;
+        }
+        text->size = 2 * (text->length + written + 1);
+        text->text = realloc(text->text, text->size);
+        assert_non_null(text->text);
+    }
+}
+
+static uint8_t* read_file(const char* path, size_t* size) {
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    uint8_t* data = malloc(*size + 1);
+    assert_non_null(data);
+    assert_int_equal(fread(data, 1, *size, f), *size);
+    data[*size] = '\0';
+    fclose(f);
+    return data;
+}
+
+static const char* status_name(int status) {
+    switch (status) {
+        case SYMBOL_DISPLAY_OK: return "ok";
+        case SYMBOL_DISPLAY_NOT_ENOUGH_DATA: return "not enough data";
+        case SYMBOL_DISPLAY_INVALID_DATA: return "invalid data";
+        case SYMBOL_DISPLAY_TOO_MANY_FIELDS: return "too many fields";
+        case SYMBOL_DISPLAY_DATA_TOO_LARGE: return "data too large";
+        default: return "unknown";
+    }
+}
+
+// the screens of a transaction, as accepted on testnet or else on mainnet
+static void render(const uint8_t* data, size_t length, text_t* text) {
+    static symbol_display_arena_t arena;
+    static char label[SYMBOL_DISPLAY_LABEL_SIZE];
+    static char value[SYMBOL_DISPLAY_VALUE_SIZE];
+
+    symbol_display_network_t network = SYMBOL_DISPLAY_TESTNET;
+    int status = symbol_display_parse(&arena, data, length, network);
+    if (status == SYMBOL_DISPLAY_INVALID_DATA) {
+        network = SYMBOL_DISPLAY_MAINNET;
+        status = symbol_display_parse(&arena, data, length, network);
+    }
+
+    append(text, "# %s, %s", network == SYMBOL_DISPLAY_MAINNET ? "mainnet" : "testnet", status_name(status));
+    if (status != SYMBOL_DISPLAY_OK) {
+        append(text, "\n");
+        return;
+    }
+    append(text, ", signs %zu of %zu bytes\n", symbol_display_sign_length(&arena), length);
+
+    symbol_display_iter_t iter;
+    symbol_display_begin(&arena, &iter);
+    while (symbol_display_next(&iter, label, value)) {
+        append(text, "%s: %s\n", label, value);
+    }
+}
+
+static int compare_names(const void* a, const void* b) {
+    return strcmp(*(char* const*) a, *(char* const*) b);
+}
+
+// reports the first line that differs, false if they differ
+static bool same_snapshot(const char* path, const char* expected, const char* actual) {
+    int line = 1;
+    while (*expected != '\0' && *expected == *actual) {
+        line += *expected == '\n';
+        expected++;
+        actual++;
+    }
+    if (*expected == *actual) {
+        return true;
+    }
+    while (line > 1 && expected[-1] != '\n') {
+        expected--;
+        actual--;
+    }
+    printf("%s:%d\n  expected: %.*s\n  actual:   %.*s\n", path, line, (int) strcspn(expected, "\n"), expected,
+           (int) strcspn(actual, "\n"), actual);
+    return false;
+}
+
+static void test_snapshots(void** state) {
+    (void) state;
+    unsigned int checked = 0, failed = 0, written = 0;
+    double renderSeconds = 0;
+    text_t text = {malloc(4096), 0, 4096};
+    assert_non_null(text.text);
+
+    for (int d = 0; d < G_directory_count; d++) {
+        DIR* dir = opendir(G_directories[d]);
+        if (dir == NULL) {
+            fail_msg("cannot open %s", G_directories[d]);
+        }
+        char** names = NULL;
+        size_t count = 0;
+        struct dirent* entry;
+        while ((entry = readdir(dir)) != NULL) {
+            size_t length = strlen(entry->d_name);
+            if (length > 4 && strcmp(entry->d_name + length - 4, ".raw") == 0) {
+                names = realloc(names, (count + 1) * sizeof(char*));
+                assert_non_null(names);
+                names[count++] = strndup(entry->d_name, length - 4);
+            }
+        }
+        closedir(dir);
+        qsort(names, count, sizeof(char*), compare_names);
+
+        for (size_t i = 0; i < count; i++) {
+            char path[4096];
+            size_t length;
+            snprintf(path, sizeof(path), "%s/%s.raw", G_directories[d], names[i]);
+            uint8_t* data = read_file(path, &length);
+            assert_non_null(data);
+
+            struct timespec start, end;
+            text.length = 0;
+            text.text[0] = '\0';
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            render(data, length, &text);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            renderSeconds += (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+            free(data);
+
+            snprintf(path, sizeof(path), "%s/%s.txt", G_directories[d], names[i]);
+            free(names[i]);
+            char* snapshot = (char*) read_file(path, &length);
+            checked++;
+            if (snapshot != NULL && same_snapshot(path, snapshot, text.text)) {
+                free(snapshot);
+                continue;
+            }
+            if (G_update) {
+                FILE* f = fopen(path, "wb");
+                assert_non_null(f);
+                assert_int_equal(fwrite(text.text, 1, text.length, f), text.length);
+                fclose(f);
+                written++;
+            } else {
+                if (snapshot == NULL) {
+                    printf("%s: missing, run with --update to create it\n", path);
+                }
+                failed++;
+            }
+            free(snapshot);
+        }
+        free(names);
+    }
+    free(text.text);
+
+    printf("%u transactions in %.3f ms (%.2f us each), %u written\n", checked, renderSeconds * 1e3,
+           checked ? renderSeconds * 1e6 / checked : 0.0, written);
+    if (failed > 0) {
+        fail_msg("%u snapshots differ, run with --update if the change is expected", failed);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--update") == 0) {
+            G_update = true;
+        } else if (G_directory_count < MAX_DIRECTORIES) {
+            G_directories[G_directory_count++] = argv[i];
+        }
+    }
+    if (G_directory_count == 0) {
+        G_directories[G_directory_count++] = "../testcases";
+    }
+
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_snapshots),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
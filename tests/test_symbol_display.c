@@ -0,0 +1,118 @@
+#include <malloc.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cmocka.h"
+
+#include "symbol_display.h"
+
+typedef struct {
+    const char *label;
+    const char *value;
+} screen_t;
+
+static uint8_t *load_transaction_data(const char *filename, size_t *size) {
+    FILE *f = fopen(filename, "rb");
+    assert_non_null(f);
+
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    uint8_t *data = malloc(*size);
+    assert_non_null(data);
+    assert_int_equal(fread(data, 1, *size, f), *size);
+    fclose(f);
+    return data;
+}
+
+static void check_screens( const symbol_display_arena_t *arena, const screen_t *expected, size_t count )
+{
+    symbol_display_iter_t iter;
+    char label[SYMBOL_DISPLAY_LABEL_SIZE];
+    char value[SYMBOL_DISPLAY_VALUE_SIZE];
+
+    symbol_display_begin(arena, &iter);
+    for( size_t i = 0; i < count; i++ )
+    {
+        assert_true( symbol_display_next(&iter, label, value) );
+        assert_string_equal( label, expected[i].label );
+        assert_string_equal( value, expected[i].value );
+    }
+    assert_false( symbol_display_next(&iter, label, value) );
+}
+
+static void test_display_transfer(void **state) {
+    (void) state;
+
+    const screen_t expected[] = {
+        {"Transaction Type", "Transfer"},
+        {"Recipient", "TDZKL2HAMOWRVEEF55NVCZ7C6GSWIXCI7IWAESI"},
+        {"Mosaics", "Found 1"},
+        {"Unknown Mosaic", "Divisibility and levy cannot be shown"},
+        {"Amount", "45000000 micro 0x5E62990DCAC5B21A"},
+        {"Message Type", "Plain text"},
+        {"Message", "This is a test message"},
+        {"Fee", "2 XYM"}
+    };
+
+    size_t length;
+    uint8_t *tx = load_transaction_data("../testcases/transfer_transaction_not_xym.raw", &length);
+    symbol_display_arena_t arena;
+
+    assert_int_equal( symbol_display_parse(&arena, tx, length, SYMBOL_DISPLAY_TESTNET), SYMBOL_DISPLAY_OK );
+    assert_int_equal( symbol_display_sign_length(&arena), length );
+    check_screens(&arena, expected, sizeof(expected) / sizeof(expected[0]));
+
+    // the header declares testnet, a mainnet path is refused
+    assert_int_equal( symbol_display_parse(&arena, tx, length, SYMBOL_DISPLAY_MAINNET), SYMBOL_DISPLAY_INVALID_DATA );
+    check_screens(&arena, NULL, 0);
+
+    free(tx);
+}
+
+static void test_display_batch(void **state) {
+    (void) state;
+
+    size_t transferLength, supplyLength;
+    uint8_t *transfer = load_transaction_data("../testcases/transfer_transaction_not_xym.raw", &transferLength);
+    uint8_t *supply   = load_transaction_data("../testcases/supply_change_mosaic.raw", &supplyLength);
+
+    const symbol_display_tx_t txs[3] = {
+        { transfer, transferLength     },
+        { supply,   supplyLength - 1   },
+        { supply,   supplyLength       },
+    };
+    symbol_display_arena_t arenas[3];
+    int statuses[3];
+
+    assert_int_equal( symbol_display_parse_batch(arenas, txs, statuses, 3, SYMBOL_DISPLAY_TESTNET), 2 );
+    assert_int_equal( statuses[0], SYMBOL_DISPLAY_OK );
+    assert_int_equal( statuses[1], SYMBOL_DISPLAY_NOT_ENOUGH_DATA );
+    assert_int_equal( statuses[2], SYMBOL_DISPLAY_OK );
+
+    const screen_t expected[] = {
+        {"Transaction Type", "Mosaic Supply Change"},
+        {"Mosaic ID", "7CDF3B117A3C40CC"},
+        {"Change Direction", "Increase"},
+        {"Change Amount", "1000000"},
+        {"Fee", "2 XYM"}
+    };
+    check_screens(&arenas[2], expected, sizeof(expected) / sizeof(expected[0]));
+
+    free(transfer);
+    free(supply);
+}
+
+int main(void) {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_display_transfer),
+        cmocka_unit_test(test_display_batch),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
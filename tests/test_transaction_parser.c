@@ -8,9 +8,7 @@
 
 #include "parse/xym_parse.h"
 #include "format/format.h"
-#include "apdu/global.h"  // FIXME: transaction_context_t should be defined elsewhere
-
-transaction_context_t transactionContext;
+#include "format/printers.h"
 
 typedef struct {
     const char *field_name;
@@ -37,38 +35,49 @@ static uint8_t *load_transaction_data(const char *filename, size_t *size) {
 
 
 
-static void check_transaction_results( const char *filename, int num_fields, const result_entry_t *expected )
+static void check_transaction_data( const uint8_t *tx_data, size_t tx_length, int num_fields, const result_entry_t *expected )
 {
     buffer_t       rawTxData;
     fields_array_t fields;
     
     char field_name [ MAX_FIELDNAME_LEN ];
-    char field_value[ MAX_FIELD_LEN     ];
-
-    size_t tx_length;
-    uint8_t * const tx_data = load_transaction_data(filename, &tx_length);
-    assert_non_null(tx_data);
+    char page_value [ MAX_FIELD_LEN     ];
+    char field_value[ 2 * MAX_RAW_TX + 1 ];
 
     rawTxData.ptr    = tx_data;
     rawTxData.size   = tx_length;
     rawTxData.offset = 0;
     
-    assert_int_equal( parse_txn_context(&rawTxData, &fields), 0          );
+    assert_int_equal( parse_txn_context(&rawTxData, false, &fields), 0          );
     assert_int_equal( fields.numFields,                       num_fields );
 
     for( int i = 0; i < fields.numFields; i++ )
     {
         const field_t *field = &fields.arr[i];
         resolve_fieldname(field, field_name);
-        format_field(field, field_value);
+
+        // long fields are compared with all their pages put back together
+        field_value[0] = '\0';
+        for( uint8_t page = 0; page < field_page_count(field); page++ )
+        {
+            format_field_page(field, page, page_value);
+            strcat(field_value, page_value);
+        }
         
         assert_string_equal( expected[i].field_name,  field_name  );
         assert_string_equal( expected[i].field_value, field_value );
     }
-    
-    free(tx_data);
+}
 
-    return;
+static void check_transaction_results( const char *filename, int num_fields, const result_entry_t *expected )
+{
+    size_t tx_length;
+    uint8_t * const tx_data = load_transaction_data(filename, &tx_length);
+    assert_non_null(tx_data);
+
+    check_transaction_data(tx_data, tx_length, num_fields, expected);
+
+    free(tx_data);
 }
 
 static void test_parse_transfer_transaction(void **state) {
@@ -468,6 +477,195 @@ static void test_parse_persistent_harvesting_delegation_transfer(void **state) {
     check_transaction_results("../testcases/persistent_harvesting_delegation_transfer.raw", sizeof(expected) / sizeof(expected[0]), expected);
 }
 
+// Aggregate complete of 'count' transfers of 1 XYM, sent in turn to 'recipients' testnet addresses
+static size_t build_transfer_batch( uint8_t *tx, size_t count, size_t recipients )
+{
+    const uint16_t aggregateType = XYM_TXN_AGGREGATE_COMPLETE;
+    const uint16_t transferType  = XYM_TXN_TRANSFER;
+    const uint32_t innerSize     = 96;
+    const uint32_t payloadSize   = count * innerSize;
+    const uint64_t mosaicId      = XYM_TESTNET_MOSAIC_ID;
+    const uint64_t amount        = 1000000;
+    const uint64_t maxFee        = 50000;
+    size_t length = 0;
+
+    memset(tx, 0, 100 + payloadSize);
+    tx[33] = TESTNET_NETWORK_TYPE;
+    memcpy(&tx[34], &aggregateType, sizeof(uint16_t));
+    memcpy(&tx[36], &maxFee,        sizeof(uint64_t));
+    memcpy(&tx[84], &payloadSize,   sizeof(uint32_t));
+    length = 92;
+
+    for( size_t i = 0; i < count; i++ )
+    {
+        uint8_t *inner = &tx[length];
+        memcpy(&inner[0],  &innerSize,    sizeof(uint32_t));
+        inner[45] = TESTNET_NETWORK_TYPE;
+        memcpy(&inner[46], &transferType, sizeof(uint16_t));
+        inner[48] = TESTNET_NETWORK_TYPE;              // recipient address
+        inner[49] = (uint8_t) (i % recipients);
+        inner[74] = 1;                                 // mosaics count
+        memcpy(&inner[80], &mosaicId,     sizeof(uint64_t));
+        memcpy(&inner[88], &amount,       sizeof(uint64_t));
+        length += innerSize;
+    }
+    return length;
+}
+
+static void test_parse_aggregate_transfer_summary(void **state) {
+    (void) state;
+
+    uint8_t tx[100 + 100 * 96];
+
+    // too many fields to be shown one by one, each recipient is listed
+    const result_entry_t few_recipients[] = {
+        {"Transaction Type", "Aggregate Complete"},
+        {"Agg. Tx Hash", "0000000000000000000000000000000000000000000000000000000000000000"},
+        {"Inner Transfers", "20"},
+        {"Recipients", "3"},
+        {"Total", "20 XYM"},
+        {"Recipient", "TAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"},
+        {"Amount", "7 XYM"},
+        {"Recipient", "TAAQAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"},
+        {"Amount", "7 XYM"},
+        {"Recipient", "TABAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"},
+        {"Amount", "6 XYM"},
+        {"Fee", "0.05 XYM"}
+    };
+    check_transaction_data(tx, build_transfer_batch(tx, 20, 3), sizeof(few_recipients) / sizeof(few_recipients[0]), few_recipients);
+
+    // payroll: only the totals
+    const result_entry_t many_recipients[] = {
+        {"Transaction Type", "Aggregate Complete"},
+        {"Agg. Tx Hash", "0000000000000000000000000000000000000000000000000000000000000000"},
+        {"Inner Transfers", "100"},
+        {"Recipients", "More than 8"},
+        {"Total", "100 XYM"},
+        {"Fee", "0.05 XYM"}
+    };
+    check_transaction_data(tx, build_transfer_batch(tx, 100, 90), sizeof(many_recipients) / sizeof(many_recipients[0]), many_recipients);
+}
+
+static void test_parse_aggregate_inner_transaction_starts(void **state) {
+    (void) state;
+
+    uint8_t tx[100 + 100 * 96];
+    fields_array_t fields;
+
+    // type, hash, then type, recipient, amount and message of each transfer
+    buffer_t rawTxData = { tx, build_transfer_batch(tx, 3, 3), 0 };
+    assert_int_equal( parse_txn_context(&rawTxData, false, &fields), E_SUCCESS );
+    assert_int_equal( fields.innerCount,    3  );
+    assert_int_equal( fields.innerStart[0], 2  );
+    assert_int_equal( fields.innerStart[1], 6  );
+    assert_int_equal( fields.innerStart[2], 10 );
+    assert_int_equal( *(const uint16_t*) fields.arr[fields.innerStart[2]].data, XYM_TXN_TRANSFER );
+
+    // summarised transfers are not shown one by one, and nothing of the attempt is left
+    memset(&fields, 0, sizeof(fields));
+    rawTxData = (buffer_t) { tx, build_transfer_batch(tx, 20, 3), 0 };
+    assert_int_equal( parse_txn_context(&rawTxData, false, &fields), E_SUCCESS );
+    assert_int_equal( fields.innerCount, 0 );
+    const field_t empty = {0};
+    for (size_t i = fields.numFields; i < MAX_FIELD_COUNT; i++) {
+        assert_memory_equal( &fields.arr[i], &empty, sizeof(empty) );
+    }
+    for (size_t i = 0; i < MAX_INNER_TX_COUNT; i++) {
+        assert_int_equal( fields.innerStart[i], 0 );
+    }
+}
+
+static int check_header_of( const char *filename, size_t chunk_length, bool is_mainnet, size_t patch_offset, uint8_t patch_value )
+{
+    size_t tx_length;
+    uint8_t * const tx_data = load_transaction_data(filename, &tx_length);
+    assert_non_null(tx_data);
+
+    if( patch_offset != 0 ) { tx_data[patch_offset] = patch_value; }
+
+    const buffer_t chunk = { tx_data, (chunk_length < tx_length) ? chunk_length : tx_length, 0 };
+    const int status = check_txn_header(&chunk, is_mainnet, MAX_RAW_TX);
+
+    free(tx_data);
+    return status;
+}
+
+static void test_check_header_accepts_supported_transactions(void **state) {
+    (void) state;
+
+    assert_int_equal( check_header_of("../testcases/transfer_transaction.raw",          100, false, 0, 0), E_SUCCESS );
+    assert_int_equal( check_header_of("../testcases/create_mosaic.raw",                 100, false, 0, 0), E_SUCCESS );
+    assert_int_equal( check_header_of("../testcases/account_address_restriction.raw",   100, false, 0, 0), E_SUCCESS );
+    assert_int_equal( check_header_of("../testcases/cosignature_transaction.raw",       100, false, 0, 0), E_SUCCESS );
+    assert_int_equal( check_header_of("../testcases/transfer_transaction.raw",           20, true,  0, 0), E_SUCCESS ); // header not complete yet
+}
+
+static void test_check_header_rejects_network_and_type(void **state) {
+    (void) state;
+
+    assert_int_equal( check_header_of("../testcases/transfer_transaction.raw", 100, true,  0,  0),    E_INVALID_DATA ); // testnet transaction, mainnet path
+    assert_int_equal( check_header_of("../testcases/transfer_transaction.raw", 100, false, 35, 0x42), E_INVALID_DATA ); // secret lock (0x4252)
+}
+
+static void test_check_header_rejects_declared_sizes(void **state) {
+    (void) state;
+
+    assert_int_equal( check_header_of("../testcases/create_mosaic.raw",        100, false, 86, 0xFF), E_DATA_TOO_LARGE  ); // aggregate payloadSize
+    assert_int_equal( check_header_of("../testcases/transfer_transaction.raw", 100, false, 78, 0xC8), E_TOO_MANY_FIELDS ); // 200 mosaics
+}
+
+static void test_format_long_fields_in_pages(void **state) {
+    (void) state;
+
+    char value[MAX_FIELD_LEN];
+    uint8_t data[2 * MAX_FIELD_LEN + 10];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = 'a' + (i % 26);
+    }
+
+    // plain text: MAX_FIELD_LEN - 1 characters per page
+    const field_t message = { XYM_STR_TXN_MESSAGE, STI_MESSAGE, sizeof(data), data };
+    assert_int_equal( field_page_count(&message), 3 );
+    format_field_page(&message, 2, value);
+    assert_int_equal( strlen(value), sizeof(data) - 2 * (MAX_FIELD_LEN - 1) );
+    assert_memory_equal( value, &data[2 * (MAX_FIELD_LEN - 1)], strlen(value) );
+
+    // hex: two characters per byte
+    const field_t harvesting = { XYM_STR_TXN_HARVESTING, STI_HEX_MESSAGE, MAX_FIELD_LEN, data };
+    assert_int_equal( field_page_count(&harvesting), 3 );
+    format_field_page(&harvesting, 2, value);
+    assert_int_equal( strlen(value), 2 * (MAX_FIELD_LEN - 2 * (MAX_FIELD_LEN/2 - 1)) );
+
+    // short and non text fields are shown on one page
+    const field_t shortMessage = { XYM_STR_TXN_MESSAGE, STI_MESSAGE, 10, data };
+    const field_t hash = { XYM_HASH256_AGG_HASH, STI_HASH256, XYM_TRANSACTION_HASH_LENGTH, data };
+    assert_int_equal( field_page_count(&shortMessage), 1 );
+    assert_int_equal( field_page_count(&hash), 1 );
+}
+
+static void test_field_names_and_formatters(void **state) {
+    (void) state;
+
+    const uint8_t count = 2;
+    char value[MAX_FIELD_LEN];
+
+    // labels are looked up by id, the data type must match
+    const field_t deletions = { XYM_UINT8_AM_RESTRICTION_DEL, STI_UINT8_DELETION, sizeof(uint8_t), &count };
+    assert_string_equal( get_field_name(&deletions), "Deletion Count" );
+    format_field(&deletions, value);
+    assert_string_equal( value, "2 mosaic(s)" );
+
+    const field_t alias = { XYM_STR_RECIPIENT_ALIAS, STI_STR, 0, &count };
+    assert_string_equal( get_field_name(&alias), "Recipient" );
+    format_field(&alias, value);
+    assert_string_equal( value, "alias to a namespace" );
+
+    const field_t mismatch = { XYM_STR_RECIPIENT_ALIAS, STI_UINT8, sizeof(uint8_t), &count };
+    assert_string_equal( get_field_name(&mismatch), "Unknown Field" );
+    format_field(&mismatch, value);
+    assert_string_equal( value, "[Not implemented]" );
+}
+
 int main(void) {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_parse_transfer_transaction),
@@ -493,7 +691,14 @@ int main(void) {
         cmocka_unit_test(test_parse_mosaic_metadata_transaction),
         cmocka_unit_test(test_parse_namespace_metadata_transaction),
         cmocka_unit_test(test_parse_delegated_harvesting),
-        cmocka_unit_test(test_parse_persistent_harvesting_delegation_transfer)
+        cmocka_unit_test(test_parse_persistent_harvesting_delegation_transfer),
+        cmocka_unit_test(test_parse_aggregate_transfer_summary),
+        cmocka_unit_test(test_parse_aggregate_inner_transaction_starts),
+        cmocka_unit_test(test_check_header_accepts_supported_transactions),
+        cmocka_unit_test(test_check_header_rejects_network_and_type),
+        cmocka_unit_test(test_check_header_rejects_declared_sizes),
+        cmocka_unit_test(test_format_long_fields_in_pages),
+        cmocka_unit_test(test_field_names_and_formatters)
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
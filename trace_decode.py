@@ -0,0 +1,208 @@
+#!/usr/bin/env python
+# *******************************************************************************
+# *   Symbol Wallet
+# *   (c) 2020 Ledger
+# *   (c) 2020 FDS
+# *
+# *  Licensed under the Apache License, Version 2.0 (the "License");
+# *  you may not use this file except in compliance with the License.
+# *  You may obtain a copy of the License at
+# *
+# *      http://www.apache.org/licenses/LICENSE-2.0
+# *
+# *  Unless required by applicable law or agreed to in writing, software
+# *  distributed under the License is distributed on an "AS IS" BASIS,
+# *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# *  See the License for the specific language governing permissions and
+# *  limitations under the License.
+# ********************************************************************************
+#
+# Reads the trace ring of an app built with TRACE=1 (GET_TRACE, see
+# src/apdu/messages/get_trace.h) and prints where the time went.
+#
+# On the device the clock is the 100 ms ticker, which only advances between
+# APDUs and while the app waits for the user: its records are ordered, but all
+# the phases of an APDU share the same tick, so only the time per instruction
+# is printed for such a trace.
+#
+#   trace_decode.py                    read from the device (ledgerblue)
+#   trace_decode.py --tcp 9999         read from 'apdu_replay --tcp 9999'
+#   trace_decode.py --log replay.txt   decode the GET_TRACE responses ('<= ...' lines) of 'apdu_replay --script'
+#   --clear                            clear the ring once it has been read
+#   --events                           also list every record
+import argparse
+import socket
+import struct
+import sys
+
+GET_TRACE = "E00A"
+RECORDS_PER_APDU = 30
+HEADER_SIZE = 10
+RECORD_SIZE = 8
+TICKER_PERIOD_US = 100000   # device clock, does not advance while an APDU is handled
+
+EVENTS = {
+    0x01: "apdu received",
+    0x02: "response sent",
+    0x10: "parse begin",
+    0x11: "parse end",
+    0x20: "format begin",
+    0x21: "format end",
+    0x30: "derive begin",
+    0x31: "derive end",
+    0x40: "sign begin",
+    0x41: "sign end",
+}
+
+# begin event -> (end event, phase name)
+PHASES = {
+    0x10: (0x11, "parse"),
+    0x20: (0x21, "format"),
+    0x30: (0x31, "derive"),
+    0x40: (0x41, "sign"),
+}
+
+INSTRUCTIONS = {0x02: "GET_PUBLIC_KEY", 0x04: "SIGN_TX", 0x06: "GET_VERSION", 0x08: "SELECT_ACCOUNT",
+                0x0E: "PREVIEW_TX", 0x10: "EDIT_ADDRESS_BOOK"}
+
+
+def ledger_exchange():
+    from ledgerblue.comm import getDongle
+    dongle = getDongle(False)
+    return lambda apdu: bytes(dongle.exchange(apdu)) + b"\x90\x00"
+
+
+def tcp_exchange(port):
+    sock = socket.create_connection(("127.0.0.1", port))
+
+    def receive(size):
+        data = b""
+        while len(data) < size:
+            chunk = sock.recv(size - len(data))
+            if not chunk:
+                sys.exit("apdu_replay went away")
+            data += chunk
+        return data
+
+    def exchange(apdu):
+        sock.sendall(struct.pack(">I", len(apdu)) + apdu)
+        return receive(struct.unpack(">I", receive(4))[0])
+    return exchange
+
+
+def read_chunks(exchange, clear):
+    chunks = []
+    while True:
+        response = exchange(bytes.fromhex(GET_TRACE + "%02X0000" % len(chunks)))
+        if response[-2:] != b"\x90\x00":
+            sys.exit("GET_TRACE failed with %s, is the app built with TRACE=1?" % response[-2:].hex().upper())
+        chunks.append(response[:-2])
+        if (len(response) - 2 - HEADER_SIZE) // RECORD_SIZE < RECORDS_PER_APDU:
+            break
+    if clear:
+        exchange(bytes.fromhex(GET_TRACE + "%02X0100" % len(chunks)))
+    return chunks
+
+
+def log_chunks(path):
+    # GET_TRACE responses are the only ones starting with a trace header
+    chunks = []
+    for line in open(path):
+        if line.startswith("<= ") and len(line.strip()) > 3 + 2 * (HEADER_SIZE + 2):
+            data = bytes.fromhex(line[3:].strip())[:-2]
+            if (len(data) - HEADER_SIZE) % RECORD_SIZE == 0:
+                chunks.append(data)
+    return chunks
+
+
+def decode(chunks):
+    period, total, size = struct.unpack(">IIH", chunks[0][:HEADER_SIZE])
+    records = []
+    for chunk in chunks:
+        body = chunk[HEADER_SIZE:]
+        for offset in range(0, len(body), RECORD_SIZE):
+            records.append(struct.unpack(">IHBB", body[offset:offset + RECORD_SIZE]))
+    return period, total, size, records
+
+
+def us(ticks, period):
+    return ticks * period
+
+
+def print_events(records, period):
+    first = records[0][0] if records else 0
+    for tick, arg, event, sequence in records:
+        print("%3d %10d us  %-14s 0x%04X" % (sequence, us(tick - first, period), EVENTS.get(event, "0x%02X" % event), arg))
+
+
+def breakdown(records, period):
+    phases = {}       # phase name -> [count, total, max]
+    fields = {}       # field id -> [count, total, max]
+    apdus = {}        # INS -> [count, total, max]
+    open_phases = {}
+    received = None
+
+    def add(table, key, duration):
+        entry = table.setdefault(key, [0, 0, 0])
+        entry[0] += 1
+        entry[1] += duration
+        entry[2] = max(entry[2], duration)
+
+    for tick, arg, event, _ in records:
+        if event == 0x01:
+            received = (tick, arg)
+        elif event == 0x02 and received is not None:
+            add(apdus, received[1], tick - received[0])
+            received = None
+        elif event in PHASES:
+            open_phases[event] = (tick, arg)
+        else:
+            for begin, (end, name) in PHASES.items():
+                if event == end and begin in open_phases:
+                    start, start_arg = open_phases.pop(begin)
+                    add(phases, name, tick - start)
+                    if name == "format":
+                        add(fields, start_arg, tick - start)
+
+    def show(title, table, label):
+        if not table:
+            return
+        print("\n%-16s %8s %12s %12s %12s" % (title, "count", "total us", "mean us", "max us"))
+        for key in sorted(table, key=lambda k: -table[k][1]):
+            count, total, longest = table[key]
+            print("%-16s %8d %12d %12d %12d" % (label(key), count, us(total, period),
+                                                us(total, period) // count, us(longest, period)))
+
+    show("instruction", apdus, lambda ins: INSTRUCTIONS.get(ins, "0x%02X" % ins))
+    if period >= TICKER_PERIOD_US:
+        print("\nclock period %d us: the ticker only advances between APDUs and while waiting for the user,\n"
+              "events are in order but phases and fields are not timed" % period)
+        return
+    show("phase", phases, lambda name: name)
+    show("field id", fields, lambda field: "0x%02X" % field)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the trace ring of a TRACE=1 build")
+    parser.add_argument("--tcp", type=int, help="port of 'apdu_replay --tcp'")
+    parser.add_argument("--log", help="output of 'apdu_replay --script' ending with GET_TRACE exchanges")
+    parser.add_argument("--clear", action="store_true", help="clear the ring once it has been read")
+    parser.add_argument("--events", action="store_true", help="list every record")
+    args = parser.parse_args()
+
+    if args.log:
+        chunks = log_chunks(args.log)
+    else:
+        chunks = read_chunks(tcp_exchange(args.tcp) if args.tcp else ledger_exchange(), args.clear)
+    if not chunks:
+        sys.exit("no GET_TRACE response found")
+
+    period, total, size, records = decode(chunks)
+    print("%d records, %d overwritten, clock period %d us" % (len(records), total - size, period))
+    if args.events:
+        print_events(records, period)
+    breakdown(records, period)
+
+
+if __name__ == "__main__":
+    main()